@@ -0,0 +1,90 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+
+# Copyright (c) 2009-2020 Authors of CryptoMiniSat, see AUTHORS file
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+
+# Compares the propagation throughput of two cryptominisat5 binaries, e.g. a
+# build before and after a change to the propagation code:
+#
+#   ./propagation.py --before old/cryptominisat5 --after new/cryptominisat5 [CNF ...]
+#
+# Without CNF files, random 3-SAT instances near the threshold are generated.
+# Simplification is off, so both binaries search the same formula, and the
+# 'c Mprops' line of the final stats is compared.
+
+import argparse
+import os
+import random
+import re
+import statistics
+import subprocess
+import tempfile
+
+
+def gen_random_3sat(fname, nvars, seed):
+    rnd = random.Random(seed)
+    ncls = int(nvars*4.2)
+    with open(fname, "w") as f:
+        f.write("p cnf %d %d\n" % (nvars, ncls))
+        for _ in range(ncls):
+            lits = rnd.sample(range(1, nvars+1), 3)
+            f.write(" ".join(str(l if rnd.random() < 0.5 else -l) for l in lits) + " 0\n")
+
+
+def props_per_sec(solver, fname, maxconfl):
+    cmd = [solver, "--verb", "1", "--printsol", "0", "--presimp", "0",
+           "--schedsimp", "0", "--maxconfl", str(maxconfl), fname]
+    out = subprocess.run(cmd, stdout=subprocess.PIPE, universal_newlines=True).stdout
+    m = re.search(r"^c Mprops\s*:\s*\S+\s*\(\s*(\S+)\s*/ sec\)", out, re.MULTILINE)
+    if m is None:
+        raise RuntimeError("No propagation stats in output of: %s" % " ".join(cmd))
+    return float(m.group(1))
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Compare the propagation throughput of two cryptominisat5 binaries")
+    parser.add_argument("--before", required=True, help="Baseline cryptominisat5 binary")
+    parser.add_argument("--after", required=True, help="Changed cryptominisat5 binary")
+    parser.add_argument("--maxconfl", type=int, default=200000)
+    parser.add_argument("--repeat", type=int, default=3)
+    parser.add_argument("--nvars", type=int, default=20000, help="Size of generated instances")
+    parser.add_argument("--num", type=int, default=3, help="Number of generated instances")
+    parser.add_argument("files", nargs="*")
+    args = parser.parse_args()
+
+    tmpdir = None
+    files = args.files
+    if not files:
+        tmpdir = tempfile.TemporaryDirectory()
+        files = []
+        for i in range(args.num):
+            fname = os.path.join(tmpdir.name, "rnd-%d.cnf" % i)
+            gen_random_3sat(fname, args.nvars, i)
+            files.append(fname)
+
+    print("{:<30} {:>12} {:>12} {:>8}".format("file", "before Mp/s", "after Mp/s", "speedup"))
+    speedups = []
+    for fname in files:
+        before = statistics.median(props_per_sec(args.before, fname, args.maxconfl) for _ in range(args.repeat))
+        after = statistics.median(props_per_sec(args.after, fname, args.maxconfl) for _ in range(args.repeat))
+        speedups.append(after/before)
+        print("{:<30} {:>12.3f} {:>12.3f} {:>8.3f}".format(os.path.basename(fname), before, after, after/before))
+    print("geometric mean speedup: {:.3f}".format(statistics.geometric_mean(speedups)))
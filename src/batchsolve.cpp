@@ -0,0 +1,151 @@
+/*************************************************************
+CryptoMiniSat --- Copyright (C) 2009-2020 Authors of CryptoMiniSat, see AUTHORS file
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+***************************************************************/
+
+#include "batchsolve.h"
+#include "solver.h"
+#include "threadpool.h"
+#include "time_mem.h"
+
+#include <iomanip>
+#include <limits>
+
+using namespace CMSat;
+using std::vector;
+
+BatchSolve::BatchSolve(vector<Solver*>& _solvers, ThreadPool& _pool) :
+    solvers(_solvers)
+    , pool(_pool)
+{
+}
+
+bool BatchSolve::get_query(size_t& at)
+{
+    std::lock_guard<std::mutex> lock(mu);
+    if (stop || next >= queries->size()) return false;
+    at = next++;
+    return true;
+}
+
+void BatchSolve::unsat(const size_t tid)
+{
+    std::lock_guard<std::mutex> lock(mu);
+    if (unsat_tid == -1) unsat_tid = tid;
+    stop = true;
+    //will interrupt all of them
+    solvers[0]->set_must_interrupt_asap();
+}
+
+void BatchSolve::work(const size_t tid)
+{
+    Solver& s = *solvers[tid];
+    //The limits of the call. The conflict limit is set relative to the
+    //conflicts so far, see Solver::set_max_confl(), it's given to every query
+    const uint64_t max_confl = s.conf.max_confl;
+    const uint64_t confl_budget = max_confl == std::numeric_limits<uint64_t>::max() ?
+        max_confl : max_confl - std::min(max_confl, s.sumConflicts);
+    const double max_time = s.conf.maxTime;
+
+    s.batch_worker = true;
+    size_t at;
+    while (get_query(at)) {
+        s.conf.max_confl = std::numeric_limits<uint64_t>::max();
+        if (confl_budget != std::numeric_limits<uint64_t>::max()
+            && s.sumConflicts + confl_budget > s.sumConflicts
+        ) {
+            s.conf.max_confl = s.sumConflicts + confl_budget;
+        }
+        s.conf.maxTime = max_time;
+        const lbool ret = s.solve_with_assumptions(&(*queries)[at], false);
+
+        (*results)[at] = ret;
+        if (ret == l_True) {
+            (*models)[at] = s.get_model();
+        } else if (ret == l_False) {
+            if (!s.okay()) {
+                unsat(tid);
+                break;
+            }
+            (*conflicts)[at] = s.get_final_conflict();
+        } else if (s.must_interrupt_asap() || cpuTime() >= max_time) {
+            //Not solved for lack of time, not of conflicts
+            std::lock_guard<std::mutex> lock(mu);
+            stop = true;
+            break;
+        }
+    }
+    s.batch_worker = false;
+
+    //As after any solve()
+    s.conf.max_confl = std::numeric_limits<uint64_t>::max();
+    s.conf.maxTime = std::numeric_limits<double>::max();
+}
+
+void BatchSolve::solve(
+    const vector<vector<Lit>>& _queries,
+    vector<lbool>& _results,
+    vector<vector<lbool>>& _models,
+    vector<vector<Lit>>& _conflicts,
+    int& which_solved
+) {
+    const double my_time = cpuTime();
+    queries = &_queries;
+    results = &_results;
+    models = &_models;
+    conflicts = &_conflicts;
+    results->assign(queries->size(), l_Undef);
+    models->assign(queries->size(), vector<lbool>());
+    conflicts->assign(queries->size(), vector<Lit>());
+
+    for(size_t i = 0; i < solvers.size() && unsat_tid == -1; i++) {
+        if (!solvers[i]->okay()) unsat_tid = i;
+    }
+    //Threads without a query still reset their limits
+    stop = unsat_tid != -1;
+    pool.run(solvers.size(), [&](const size_t tid) {
+        work(tid);
+    });
+
+    if (unsat_tid != -1) {
+        which_solved = unsat_tid;
+        results->assign(queries->size(), l_False);
+        models->assign(queries->size(), vector<lbool>());
+        conflicts->assign(queries->size(), vector<Lit>());
+    }
+
+    Solver& leader = *solvers[0];
+    if (leader.conf.verbosity) {
+        uint64_t num_sat = 0;
+        uint64_t num_unsat = 0;
+        for(const lbool res: *results) {
+            num_sat += res == l_True;
+            num_unsat += res == l_False;
+        }
+        std::ios::fmtflags f(cout.flags());
+        cout << "c [batch] queries: " << queries->size()
+        << " sat: " << num_sat
+        << " unsat: " << num_unsat
+        << " undef: " << (queries->size() - num_sat - num_unsat)
+        << " T: " << std::fixed << std::setprecision(2) << (cpuTime() - my_time)
+        << endl;
+        cout.flags(f);
+    }
+}
@@ -0,0 +1,90 @@
+/*************************************************************
+CryptoMiniSat --- Copyright (C) 2009-2020 Authors of CryptoMiniSat, see AUTHORS file
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+***************************************************************/
+
+#ifndef BATCHSOLVE_H
+#define BATCHSOLVE_H
+
+#include "solvertypesmini.h"
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace CMSat {
+
+class Solver;
+class ThreadPool;
+
+/**
+@brief Solves a batch of assumption queries on the threads of a SATSolver
+
+Every thread takes the next query that's not taken yet and solves it as its
+own solve() call would, so each query gets the model or the conflict it'd
+get if they were solved one after the other. Assumptions are only decisions,
+so all that's learnt holds without them, and the threads share it as in the
+portfolio mode, see DataSync.
+
+The conflict limit is for each query, the time limit for the whole batch. A
+query that runs out of conflicts is l_Undef, an interrupt or running out of
+time makes all queries not yet solved l_Undef. Once a thread finds that the
+problem is UNSAT without assumptions, all queries are l_False with an empty
+conflict.
+*/
+class BatchSolve
+{
+    public:
+        BatchSolve(std::vector<Solver*>& solvers, ThreadPool& pool);
+
+        //All threads must have all clauses. 'which_solved' is set to the
+        //thread that found the problem UNSAT, if any, or left alone
+        void solve(
+            const std::vector<std::vector<Lit>>& queries,
+            std::vector<lbool>& results,
+            std::vector<std::vector<lbool>>& models,
+            std::vector<std::vector<Lit>>& conflicts,
+            int& which_solved
+        );
+
+    private:
+        void work(const size_t tid);
+        bool get_query(size_t& at);
+        void unsat(const size_t tid);
+
+        std::vector<Solver*>& solvers;
+        ThreadPool& pool;
+
+        const std::vector<std::vector<Lit>>* queries = nullptr;
+        std::vector<lbool>* results = nullptr;
+        std::vector<std::vector<lbool>>* models = nullptr;
+        std::vector<std::vector<Lit>>* conflicts = nullptr;
+
+        std::mutex mu;
+
+        //Guarded by 'mu'
+        size_t next = 0; ///<Next query not taken yet
+        bool stop = false;
+        int unsat_tid = -1; ///<Thread that found the problem UNSAT
+};
+
+}
+
+#endif //BATCHSOLVE_H
@@ -55,16 +55,17 @@ int ClPredictorsAbst::set_up_input(
 {
     //glue 0 can happen in case it's a ternary resolvent clause
     //updated glue can actually be 1. Original glue cannot.
-    const ClauseStatsExtra& extra_stats = solver->red_stats_extra[cl->stats.extra_pos];
+    const RedClauseStats& red_stats = solver->cl_alloc.red_stats(cl);
+    const ClauseStatsExtra& extra_stats = solver->red_stats_extra[red_stats.extra_pos];
     assert(extra_stats.orig_glue != 1);
 
-    assert(cl->stats.last_touched_any <= sumConflicts);
+    assert(red_stats.last_touched_any <= sumConflicts);
     assert(extra_stats.introduced_at_conflict <= sumConflicts);
-    uint32_t last_touched_any_diff = sumConflicts - (uint64_t)cl->stats.last_touched_any;
+    uint32_t last_touched_any_diff = sumConflicts - (uint64_t)red_stats.last_touched_any;
     double time_inside_solver = sumConflicts - (uint64_t)extra_stats.introduced_at_conflict;
 
     //To protect against unset values being used
-    assert(cl->stats.is_ternary_resolvent ||
+    assert(cl->is_ternary_resolvent ||
         extra_stats.glueHist_longterm_avg > 0.9f);
 
     uint32_t x = 0;
@@ -86,10 +87,10 @@ int ClPredictorsAbst::set_up_input(
 //     6
 
     ///////////////
-    at[x++] = cl->stats.props_made;
+    at[x++] = red_stats.props_made;
 //     rdb0.props_made
 //     10
-    at[x++] = cl->stats.uip1_used;
+    at[x++] = red_stats.uip1_used;
 //     rdb0.uip1_used
 //     11
     at[x++] = extra_stats.discounted_props_made;
@@ -112,7 +113,7 @@ int ClPredictorsAbst::set_up_input(
 //     17
 
     //////////////////
-    if (cl->stats.is_ternary_resolvent ||
+    if (cl->is_ternary_resolvent ||
         extra_stats.glueHist_longterm_avg == 0 //glueHist_longterm_avg does not exist for ternary
     ) {
         at[x++] = missing_val;
@@ -127,18 +128,18 @@ int ClPredictorsAbst::set_up_input(
     ) {
         at[x++] = missing_val;
     } else {
-        at[x++] = (double)cl->stats.uip1_used/(double)commdata.avg_uip;
+        at[x++] = (double)red_stats.uip1_used/(double)commdata.avg_uip;
     }
     //(rdb0.uip1_used/rdb0_common.avg_uip1_used)
 //     33
 
 
-    if (cl->stats.is_ternary_resolvent ||
+    if (cl->is_ternary_resolvent ||
         solver->hist.glueHistLT.avg() == 0
     ) {
         at[x++] = missing_val;
     } else {
-        at[x++] = (double)cl->stats.glue/(double)solver->hist.glueHistLT.avg();
+        at[x++] = (double)red_stats.glue/(double)solver->hist.glueHistLT.avg();
     }
     //(rdb0.glue/rdb0_common.glueHistLT_avg)
 //     34
@@ -147,7 +148,7 @@ int ClPredictorsAbst::set_up_input(
     if (commdata.avg_props == 0) {
         at[x++] = missing_val;
     } else {
-        at[x++] = (double)cl->stats.props_made/(double)commdata.avg_props;
+        at[x++] = (double)red_stats.props_made/(double)commdata.avg_props;
     }
     //(rdb0.props_made/rdb0_common.avg_props)
 //     35
@@ -171,7 +172,7 @@ int ClPredictorsAbst::set_up_input(
 //     37
 
 
-    if (cl->stats.is_ternary_resolvent ||
+    if (cl->is_ternary_resolvent ||
         extra_stats.num_total_lits_antecedents == 0
     ) {
         at[x++] = missing_val;
@@ -183,18 +184,18 @@ int ClPredictorsAbst::set_up_input(
 
 
     //////////////////
-    if (cl->stats.is_ternary_resolvent ||
+    if (cl->is_ternary_resolvent ||
         extra_stats.trail_depth_level == 0
     ) {
         at[x++] = missing_val;
     } else {
-        at[x++] = (double)cl->stats.glue/(double)extra_stats.trail_depth_level;
+        at[x++] = (double)red_stats.glue/(double)extra_stats.trail_depth_level;
     }
     //(rdb0.glue/cl.trail_depth_level)
 //     42
 
 
-    if (cl->stats.is_ternary_resolvent
+    if (cl->is_ternary_resolvent
     ) {
         at[x++] = missing_val;
     } else {
@@ -61,19 +61,21 @@ int ClPredictorsPy::set_up_input(
 {
     int x = 0;
 
-    const ClauseStatsExtra& extra_stats = solver->red_stats_extra[cl->stats.extra_pos];
-    uint32_t last_touched_any_diff = sumConflicts - (uint64_t)cl->stats.last_touched_any;
+    const RedClauseStats& red_stats = solver->cl_alloc.red_stats(cl);
+
+    const ClauseStatsExtra& extra_stats = solver->red_stats_extra[red_stats.extra_pos];
+    uint32_t last_touched_any_diff = sumConflicts - (uint64_t)red_stats.last_touched_any;
     double time_inside_solver = sumConflicts - (uint64_t)extra_stats.introduced_at_conflict;
 
-    at[x++] = cl->stats.is_ternary_resolvent;
-    at[x++] = cl->stats.which_red_array;
-    at[x++] = cl->stats.last_touched_any;
+    at[x++] = cl->is_ternary_resolvent;
+    at[x++] = red_stats.which_red_array;
+    at[x++] = red_stats.last_touched_any;
     at[x++] = act_ranking_rel;
     at[x++] = uip1_ranking_rel;
     at[x++] = prop_ranking_rel;
     at[x++] = last_touched_any_diff;
     at[x++] = time_inside_solver;
-    at[x++] = cl->stats.props_made;
+    at[x++] = red_stats.props_made;
     at[x++] = commdata.avg_props;
     at[x++] = commdata.avg_uip;
     at[x++] = solver->hist.conflSizeHistLT.avg();
@@ -86,7 +88,7 @@ int ClPredictorsPy::set_up_input(
     at[x++] = extra_stats.discounted_uip1_used2;
     at[x++] = extra_stats.discounted_uip1_used3;
     at[x++] = extra_stats.sum_uip1_used;
-    at[x++] = cl->stats.uip1_used;
+    at[x++] = red_stats.uip1_used;
     at[x++] = cl->size();
     at[x++] = sum_uip1_per_time_ranking;
     at[x++] = sum_props_per_time_ranking;
@@ -95,7 +97,7 @@ int ClPredictorsPy::set_up_input(
     at[x++] = cl->distilled;
 
     //Ternary resolvents lack glue and antecedent data
-    if (cl->stats.is_ternary_resolvent) {
+    if (cl->is_ternary_resolvent) {
         for(int i = 0; i < 14; i++) {
             at[x++] = missing_val;
         }
@@ -110,7 +112,7 @@ int ClPredictorsPy::set_up_input(
         at[x++] = extra_stats.antecedents_binred;
         at[x++] = extra_stats.num_total_lits_antecedents;
         at[x++] = extra_stats.numResolutionsHistLT_avg;
-        at[x++] = cl->stats.glue;
+        at[x++] = red_stats.glue;
         at[x++] = extra_stats.orig_glue;
         at[x++] = extra_stats.glue_before_minim;
         at[x++] = extra_stats.trail_depth_level;
@@ -111,44 +111,74 @@ struct AtecedentData
     AvgCalc<uint32_t> size_longs;
 };
 
-struct ClauseStats
+/**
+@brief Data only redundant (learnt) clauses have
+
+It is not kept in the clause header but in a side table of ClauseAllocator,
+see ClauseAllocator::red_stats(). This way irredundant clauses don't carry it
+around and more of their literals fit into a cache line.
+*/
+struct RedClauseStats
 {
-    ClauseStats()
+    RedClauseStats()
     {
         //NOTE: we *MUST* set values to high default, as we do
         //combineStats(default, newclause) to get combined stats.
         glue = 1000;
         is_decision = false;
-        marked_clause = false;
         ttl = 0;
         which_red_array = 7; //intentionally breaking it so we catch bugs, 7 NEVER exists
         locked_for_data_gen = 0;
-        is_ternary_resolvent = 0;
+        imported = false;
         activity = 0;
-        is_tracked = false;
     }
 
     //Stored data
     uint32_t glue:20;  //currently in code limited to 100'000
     uint32_t is_decision:1; //a "decision clause", i.e. made out of decisions leading to conflict, not resolution
-    uint32_t marked_clause:1;
     uint32_t ttl:1;
     uint32_t which_red_array:3;
     uint32_t locked_for_data_gen:1;
-    uint32_t is_ternary_resolvent:1;
-    uint32_t is_tracked:1;
-    union {
-        float   activity;
-        uint32_t hash_val; //used in BreakID to remove equivalent clauses
-    };
+    uint32_t imported:1; ///<Learnt by another thread, and not yet used by us
+    float   activity;
     uint32_t last_touched_any = 0;
-    int32_t id;
 
     #if defined(STATS_NEEDED) || defined (FINAL_PREDICTOR)
     uint32_t extra_pos = numeric_limits<uint32_t>::max();
     uint32_t uip1_used = 0; ///N.o. times claue was used during 1st UIP generation in this RDB
     uint32_t props_made = 0; ///<Number of times caused propagation
+
+    void update_rdb_stats()
+    {
+    }
+
+    void reset_rdb_stats()
+    {
+        uip1_used = 0;
+        props_made = 0;
+    }
     #endif
+};
+
+/**
+@brief All the stats of a clause, header and side table together
+
+Used to carry the stats of a clause over to another one, see
+ClauseAllocator::get_stats() and ClauseAllocator::set_stats()
+*/
+struct ClauseStats : public RedClauseStats
+{
+    ClauseStats()
+    {
+        marked_clause = false;
+        is_ternary_resolvent = 0;
+        is_tracked = false;
+    }
+
+    uint32_t marked_clause:1;
+    uint32_t is_ternary_resolvent:1;
+    uint32_t is_tracked:1;
+    int32_t id;
 
     static ClauseStats combineStats(const ClauseStats& first, const ClauseStats& second)
     {
@@ -178,18 +208,6 @@ struct ClauseStats
 
         return ret;
     }
-
-    #if defined(STATS_NEEDED) || defined (FINAL_PREDICTOR)
-    void update_rdb_stats()
-    {
-    }
-
-    void reset_rdb_stats()
-    {
-        uip1_used = 0;
-        props_made = 0;
-    }
-    #endif
 };
 
 #if defined(STATS_NEEDED) || defined (FINAL_PREDICTOR)
@@ -275,7 +293,7 @@ struct ClauseStatsExtra
         return orig;
     }
 
-    void update_rdb_stats(ClauseStats& stats)
+    void update_rdb_stats(RedClauseStats& stats)
     {
         sum_uip1_used += stats.uip1_used;
         sum_props_made += stats.props_made;
@@ -294,7 +312,7 @@ struct ClauseStatsExtra
         stats.update_rdb_stats();
     }
 
-    void reset_rdb_stats(ClauseStats& stats)
+    void reset_rdb_stats(RedClauseStats& stats)
     {
         #ifdef STATS_NEEDED
         antec_data.clear();
@@ -362,7 +380,6 @@ to hold the clause.
 class Clause
 {
 public:
-    ClauseStats stats;
     uint32_t isRed:1; ///<Is the clause a redundant clause?
     uint32_t isRemoved:1; ///<Is this clause queued for removal?
     uint32_t isFreed:1; ///<Has this clause been marked as freed by the ClauseAllocator ?
@@ -374,6 +391,9 @@ public:
     uint32_t reloced:1;
     uint32_t disabled:1;
     uint32_t tried_to_remove:1;
+    uint32_t marked_clause:1;
+    uint32_t is_ternary_resolvent:1;
+    uint32_t is_tracked:1;
 
 
     Lit* getData()
@@ -389,15 +409,20 @@ public:
 public:
     cl_abst_type abst;
     uint32_t mySize;
+    int32_t id;
+    union {
+        uint32_t red_stats_at; ///<Position in ClauseAllocator's side table, if red()
+        uint32_t hash_val; //used in BreakID to remove equivalent (irred) clauses
+        uint32_t shared_at; ///<Position among the shared irredundant clauses, if in the shared region
+    };
 
     template<class V>
-    Clause(const V& ps, const uint32_t _introduced_at_conflict, const uint32_t _ID)
+    Clause(const V& ps, const uint32_t _ID)
     {
         //assert(ps.size() > 2);
 
-        stats.last_touched_any = _introduced_at_conflict;
         assert(_ID > 0);
-        stats.id = _ID;
+        id = _ID;
 
         isFreed = false;
         mySize = ps.size();
@@ -409,6 +434,10 @@ public:
         reloced = false;
         disabled = false;
         tried_to_remove = 0;
+        marked_clause = false;
+        is_ternary_resolvent = false;
+        is_tracked = false;
+        red_stats_at = numeric_limits<uint32_t>::max();
 
         for (uint32_t i = 0; i < ps.size(); i++) {
             getData()[i] = ps[i];
@@ -482,12 +511,6 @@ public:
         return *(getData() + i);
     }
 
-    void make_irred()
-    {
-        assert(isRed);
-        isRed = false;
-    }
-
     void strengthen(const Lit p)
     {
         remove(*this, p);
@@ -528,15 +551,6 @@ public:
 
     bool get_occur_linked() const { return occurLinked; }
     void set_occur_linked(bool toset) { occurLinked = toset; }
-    void print_extra_stats() const {
-        cout
-        << "Clause size " << std::setw(4) << size();
-        if (red()) {
-            cout << " glue : " << std::setw(4) << stats.glue;
-        }
-        cout << endl;
-    }
-
     void copy_to(vector<Lit>& lits) {
         lits.clear();
         for(const Lit l: *this) {
@@ -553,7 +567,7 @@ inline std::ostream& operator<<(std::ostream& os, const Clause& cl)
         if (i+1 != cl.size())
             os << " ";
     }
-    os << " -- ID: " << cl.stats.id;
+    os << " -- ID: " << cl.id;
 
     return os;
 }
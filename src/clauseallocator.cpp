@@ -35,6 +35,7 @@ THE SOFTWARE.
 #include "time_mem.h"
 #include "sqlstats.h"
 #include "gaussian.h"
+#include "hugepages.h"
 
 #ifdef USE_VALGRIND
 #include "valgrind/valgrind.h"
@@ -56,15 +57,21 @@ using std::endl;
 #define MIN_LIST_SIZE (50000 * (sizeof(Clause) + 4*sizeof(Lit))/sizeof(BASE_DATA_TYPE))
 #define ALLOC_GROW_MULT 1.5
 
-#define MAXSIZE ((1ULL << (EFFECTIVELY_USEABLE_BITS))-1)
+//Per region, the top bits of the offset are the region
+#define MAXSIZE ((1ULL << (EFFECTIVELY_USEABLE_BITS - region_bits))-1)
 
-ClauseAllocator::ClauseAllocator() :
-    dataStart(nullptr)
-    , size(0)
-    , capacity(0)
-    , currentlyUsedSize(0)
+ClauseAllocator::ClauseAllocator()
 {
     assert(MIN_LIST_SIZE < MAXSIZE);
+    for(uint32_t r = 0; r < num_regions; r++) {
+        compacting[r] = false;
+        moved_from[r] = 0;
+    }
+}
+
+uint64_t ClauseAllocator::Region::max_size() const
+{
+    return ((uint64_t)MAXSIZE + 1) << unit_shift;
 }
 
 /**
@@ -72,35 +79,94 @@ ClauseAllocator::ClauseAllocator() :
 */
 ClauseAllocator::~ClauseAllocator()
 {
-    free(dataStart);
+    for(auto& reg: regions) {
+        if (!reg.borrowed) free_region(reg);
+    }
 }
 
-void* ClauseAllocator::allocEnough(
-    uint32_t num_lits
-) {
-    //Try to quickly find a place at the end of a dataStart
-    uint64_t neededbytes = sizeof(Clause) + sizeof(Lit)*num_lits;
-    uint64_t needed
-        = neededbytes/sizeof(BASE_DATA_TYPE) + (bool)(neededbytes % sizeof(BASE_DATA_TYPE));
+void ClauseAllocator::free_region(Region& reg)
+{
+    if (reg.huge) {
+        huge_free(reg.dataStart, reg.capacity*sizeof(BASE_DATA_TYPE));
+    } else {
+        free(reg.dataStart);
+    }
+    reg.dataStart = nullptr;
+}
+
+/**
+@brief Re-allocates the region to have newcapacity, keeping its contents
+*/
+void ClauseAllocator::resize_region(Region& reg, const uint64_t newcapacity)
+{
+    const uint64_t old_bytes = reg.capacity*sizeof(BASE_DATA_TYPE);
+    const uint64_t new_bytes = newcapacity*sizeof(BASE_DATA_TYPE);
+    BASE_DATA_TYPE* new_dataStart;
+    if (reg.huge == use_hugepages) {
+        if (reg.huge) {
+            new_dataStart = (BASE_DATA_TYPE*)huge_realloc(reg.dataStart, old_bytes, new_bytes);
+        } else {
+            new_dataStart = (BASE_DATA_TYPE*)realloc(reg.dataStart, new_bytes);
+        }
+    } else {
+        //Huge pages were switched on/off since the region was allocated
+        new_dataStart = use_hugepages ?
+            (BASE_DATA_TYPE*)huge_alloc(new_bytes) : (BASE_DATA_TYPE*)malloc(new_bytes);
+        if (new_dataStart != nullptr) {
+            if (reg.size > 0) {
+                memcpy(new_dataStart, reg.dataStart, reg.size*sizeof(BASE_DATA_TYPE));
+            }
+            free_region(reg);
+        }
+    }
 
-    if (size + needed > capacity) {
+    //Realloc failed?
+    if (new_dataStart == nullptr) {
+        std::cerr
+        << "ERROR: while reallocating clause space"
+        << endl;
+
+        throw std::bad_alloc();
+    }
+    reg.dataStart = new_dataStart;
+    reg.capacity = newcapacity;
+    reg.huge = use_hugepages;
+}
+
+/**
+@brief Allocates 'needed' datapieces at the end of the region, growing it if needed
+
+Returns the position inside the region, which is aligned to the region's unit.
+The region may be re-allocated, so pointers into it are invalidated, but
+offsets are not.
+*/
+uint64_t ClauseAllocator::alloc_in(Region& reg, uint64_t needed)
+{
+    const uint64_t unit = 1ULL << reg.unit_shift;
+    needed = (needed + unit - 1) & ~(unit - 1);
+
+    if (reg.size + needed > reg.capacity) {
         //Grow by default, but don't go under or over the limits
-        uint64_t newcapacity = capacity * ALLOC_GROW_MULT;
-        newcapacity = std::max<size_t>(newcapacity, MIN_LIST_SIZE);
-        while (newcapacity < size+needed) {
+        uint64_t newcapacity = reg.capacity * ALLOC_GROW_MULT;
+        newcapacity = std::max<size_t>(newcapacity, MIN_LIST_SIZE/num_regions);
+        while (newcapacity < reg.size+needed) {
             newcapacity *= ALLOC_GROW_MULT;
         }
-        assert(newcapacity >= size+needed);
-        newcapacity = std::min<size_t>(newcapacity, MAXSIZE);
+        assert(newcapacity >= reg.size+needed);
+        if (use_hugepages) {
+            //The rest of the last huge page would be wasted otherwise
+            newcapacity = huge_round(newcapacity*sizeof(BASE_DATA_TYPE))/sizeof(BASE_DATA_TYPE);
+        }
+        newcapacity = std::min<uint64_t>(newcapacity, reg.max_size());
 
         //Oops, not enough space anyway
-        if (newcapacity < size + needed) {
+        if (newcapacity < reg.size + needed) {
             std::cerr
             << "ERROR: memory manager can't handle the load."
 #ifndef LARGE_OFFSETS
             << " **PLEASE RECOMPILE WITH -DLARGEMEM=ON**"
 #endif
-            << " size: " << size
+            << " size: " << reg.size
             << " needed: " << needed
             << " newcapacity: " << newcapacity
             << endl;
@@ -109,7 +175,7 @@ void* ClauseAllocator::allocEnough(
 #ifndef LARGE_OFFSETS
             << " **PLEASE RECOMPILE WITH -DLARGEMEM=ON**"
 #endif
-            << " size: " << size
+            << " size: " << reg.size
             << " needed: " << needed
             << " newcapacity: " << newcapacity
             << endl;
@@ -117,31 +183,27 @@ void* ClauseAllocator::allocEnough(
             throw std::bad_alloc();
         }
 
-        //Reallocate data
-        BASE_DATA_TYPE* new_dataStart;
-        new_dataStart = (BASE_DATA_TYPE*)realloc(
-            dataStart
-            , newcapacity*sizeof(BASE_DATA_TYPE)
-        );
-
-        //Realloc failed?
-        if (new_dataStart == nullptr) {
-            std::cerr
-            << "ERROR: while reallocating clause space"
-            << endl;
+        resize_region(reg, newcapacity);
+    }
 
-            throw std::bad_alloc();
-        }
-        dataStart = new_dataStart;
+    const uint64_t at = reg.size;
+    reg.size += needed;
+    reg.currentlyUsedSize += needed;
+    return at;
+}
 
-        //Update capacity to reflect the update
-        capacity = newcapacity;
-    }
+void* ClauseAllocator::allocEnough(
+    const uint32_t num_lits
+    , const uint32_t region
+) {
+    assert(region < num_regions);
+    uint64_t neededbytes = sizeof(Clause) + sizeof(Lit)*num_lits;
+    uint64_t needed
+        = neededbytes/sizeof(BASE_DATA_TYPE) + (bool)(neededbytes % sizeof(BASE_DATA_TYPE));
 
-    //Add clause to the set
-    Clause* pointer = (Clause*)(dataStart + size);
-    size += needed;
-    currentlyUsedSize += needed;
+    Region& reg = regions[region];
+    const uint64_t at = alloc_in(reg, needed);
+    Clause* pointer = (Clause*)(reg.dataStart + at);
 
     #ifdef USE_VALGRIND
     VALGRIND_MAKE_MEM_UNDEFINED((char*)pointer, neededbytes);
@@ -149,15 +211,28 @@ void* ClauseAllocator::allocEnough(
     return pointer;
 }
 
+uint32_t ClauseAllocator::region_of(const Clause* ptr) const
+{
+    const BASE_DATA_TYPE* p = (const BASE_DATA_TYPE*)ptr;
+    for(uint32_t r = 0; r < num_regions; r++) {
+        const Region& reg = regions[r];
+        if (p >= reg.dataStart && p < reg.dataStart + reg.size) return r;
+    }
+    assert(false && "Clause is not in any of the regions");
+    return 0;
+}
+
 /**
 @brief Given the pointer of the clause it finds a 32-bit offset for it
 
-Calculates the stack frame and the position of the pointer in the stack, and
-rerturns a 32-bit value that is a concatenation of these two
+Finds the region the pointer is in, and returns the position of the pointer
+in the region, with the region in the top bits
 */
 ClOffset ClauseAllocator::get_offset(const Clause* ptr) const
 {
-    return ((BASE_DATA_TYPE*)ptr - dataStart);
+    const uint32_t r = region_of(ptr);
+    return ((ClOffset)r << region_shift)
+        | (((BASE_DATA_TYPE*)ptr - regions[r].dataStart) >> regions[r].unit_shift);
 }
 
 /**
@@ -176,12 +251,16 @@ of the clause. Therefore, the "currentlyUsedSizes" is an overestimation!!
 void ClauseAllocator::clauseFree(Clause* cl)
 {
     assert(!cl->freed());
+    if (cl->red()) red_stats_free.push_back(cl->red_stats_at);
     cl->set_freed();
     uint64_t est_num_cl = cl->size();
     est_num_cl = std::max(est_num_cl, (uint64_t)3); //we sometimes allow gauss to allocate 3-long clauses
     uint64_t bytes_freed = sizeof(Clause) + est_num_cl*sizeof(Lit);
     uint64_t elems_freed = bytes_freed/sizeof(BASE_DATA_TYPE) + (bool)(bytes_freed % sizeof(BASE_DATA_TYPE));
-    currentlyUsedSize -= elems_freed;
+    Region& reg = regions[region_of(cl)];
+    const uint64_t unit = 1ULL << reg.unit_shift;
+    elems_freed = (elems_freed + unit - 1) & ~(unit - 1);
+    reg.currentlyUsedSize -= elems_freed;
 
     #ifdef VALGRIND_MAKE_MEM_UNDEFINED
     VALGRIND_MAKE_MEM_UNDEFINED(((char*)cl)+sizeof(Clause), cl->size()*sizeof(Lit));
@@ -194,43 +273,106 @@ void ClauseAllocator::clauseFree(ClOffset offset)
     clauseFree(cl);
 }
 
-ClOffset ClauseAllocator::move_cl(
-    ClOffset* newDataStart
-    , ClOffset*& new_ptr
-    , Clause* old
-) {
+void ClauseAllocator::make_red(Clause* cl)
+{
+    assert(!cl->red());
+    if (red_stats_free.empty()) {
+        cl->red_stats_at = red_stats_tab.size();
+        red_stats_tab.push_back(RedClauseStats());
+    } else {
+        cl->red_stats_at = red_stats_free.back();
+        red_stats_free.pop_back();
+        red_stats_tab[cl->red_stats_at] = RedClauseStats();
+    }
+    cl->isRed = true;
+}
+
+void ClauseAllocator::make_irred(Clause* cl)
+{
+    assert(cl->red());
+    red_stats_free.push_back(cl->red_stats_at);
+    cl->red_stats_at = numeric_limits<uint32_t>::max();
+    cl->isRed = false;
+}
+
+ClauseStats ClauseAllocator::get_stats(const Clause* cl) const
+{
+    ClauseStats stats;
+    if (cl->red()) {
+        static_cast<RedClauseStats&>(stats) = red_stats(cl);
+    }
+    stats.marked_clause = cl->marked_clause;
+    stats.is_ternary_resolvent = cl->is_ternary_resolvent;
+    stats.is_tracked = cl->is_tracked;
+    stats.id = cl->id;
+
+    return stats;
+}
+
+void ClauseAllocator::set_stats(Clause* cl, const ClauseStats& stats)
+{
+    if (cl->red()) {
+        red_stats(cl) = stats;
+    }
+    cl->marked_clause = stats.marked_clause;
+    cl->is_ternary_resolvent = stats.is_ternary_resolvent;
+    cl->is_tracked = stats.is_tracked;
+    cl->id = stats.id;
+}
+
+/**
+@brief Moves a clause of a region being compacted to the region it belongs to now
+
+Learnt clauses may have changed tiers (or become irredundant) since they were
+allocated, so this is where they get to the right region. If that region is
+not being compacted, the clause is appended to its end.
+*/
+ClOffset ClauseAllocator::move_cl(Clause* old)
+{
     uint64_t bytesNeeded = sizeof(Clause) + old->size()*sizeof(Lit);
     uint64_t sizeNeeded = bytesNeeded/sizeof(BASE_DATA_TYPE) + (bool)(bytesNeeded % sizeof(BASE_DATA_TYPE));
-    memcpy(new_ptr, old, sizeNeeded*sizeof(BASE_DATA_TYPE));
+    moved_from[region_of(old)] += sizeNeeded;
+
+    const uint32_t to = old->red() ? red_region(red_stats(old).which_red_array)
+        : (sharing_irred ? shared_region : irred_region);
+    Region& dest = compacting[to] ? new_regions[to] : regions[to];
+    const uint64_t at = alloc_in(dest, sizeNeeded);
+    memcpy(dest.dataStart + at, old, sizeNeeded*sizeof(BASE_DATA_TYPE));
 
-    ClOffset new_offset = new_ptr-newDataStart;
+    ClOffset new_offset = ((ClOffset)to << region_shift) | (at >> dest.unit_shift);
     (*old)[0] = Lit::toLit(new_offset & 0xFFFFFFFF);
     #ifdef LARGE_OFFSETS
     (*old)[1] = Lit::toLit((new_offset>>32) & 0xFFFFFFFF);
     #endif
     old->reloced = true;
-    new_sz_while_moving += sizeNeeded;
 
-    new_ptr += sizeNeeded;
     return new_offset;
 }
 
-void ClauseAllocator::move_one_watchlist(
-    watch_subarray& ws, ClOffset* newDataStart, ClOffset*& new_ptr)
+ClOffset ClauseAllocator::new_offset_of(const ClOffset offset) const
+{
+    if (!is_compacting(offset)) return offset;
+
+    const Clause* old = ptr(offset);
+    assert(old->reloced);
+    ClOffset new_offset = (*old)[0].toInt();
+    #ifdef LARGE_OFFSETS
+    new_offset += ((uint64_t)(*old)[1].toInt())<<32;
+    #endif
+    return new_offset;
+}
+
+void ClauseAllocator::move_one_watchlist(watch_subarray& ws)
 {
     for(Watched& w: ws) {
-        if (w.isClause()) {
+        if (w.isClause() && is_compacting(w.get_offset())) {
             Clause* old = ptr(w.get_offset());
             assert(!old->freed());
             Lit blocked = w.getBlockedLit();
             if (old->reloced) {
-                ClOffset new_offset = (*old)[0].toInt();
-                #ifdef LARGE_OFFSETS
-                new_offset += ((uint64_t)(*old)[1].toInt())<<32;
-                #endif
-                w = Watched(new_offset, blocked);
+                w = Watched(new_offset_of(w.get_offset()), blocked);
             } else {
-                ClOffset new_offset = move_cl(newDataStart, new_ptr, old);
+                ClOffset new_offset = move_cl(old);
                 w = Watched(new_offset, blocked);
             }
         }
@@ -238,12 +380,13 @@ void ClauseAllocator::move_one_watchlist(
 }
 
 /**
-@brief If needed, compacts stacks, removing unused clauses
+@brief If needed, compacts the regions, removing unused clauses
 
-Firstly, the algorithm determines if the number of useless slots is large or
-small compared to the problem size. If it is small, it does nothing. If it is
-large, then it allocates new stacks, copies the non-freed clauses to these new
-stacks, updates all pointers and offsets, and frees the original stacks.
+Firstly, the algorithm determines for each region if the number of useless
+slots is large or small compared to its size. If it is small, it leaves the
+region alone. If it is large, then it allocates a new stack for the region,
+copies the non-freed clauses to it (or to the region they now belong to),
+updates all pointers and offsets into the region, and frees the original stack.
 */
 void ClauseAllocator::consolidate(
     Solver* solver
@@ -254,36 +397,61 @@ void ClauseAllocator::consolidate(
     //Neccesities:
     //1) There is too much memory allocated. Re-allocation will save space
     //   Avoiding segfault (max is 16 outerOffsets, more than 10 is near)
-    //2) There is too much empty, unused space (>30%)
-    if (!force
-        && (float_div(currentlyUsedSize, size) > 0.8 || currentlyUsedSize < (100ULL*1000ULL))
-    ) {
+    //2) There is too much empty, unused space (>20%)
+    //3) The offsets of the region are running out, it must be widened
+    //4) Irredundant clauses are to be moved to the shared region
+    //The shared region is never touched, other threads use it in place
+    bool any = false;
+    bool widen[num_regions];
+    for(uint32_t r = 0; r < num_regions; r++) {
+        const Region& reg = regions[r];
+        widen[r] = r != shared_region && must_widen(reg);
+        compacting[r] = reg.size > 0
+            && r != shared_region
+            && (force
+                || widen[r]
+                || (sharing_irred && r == irred_region)
+                || (float_div(reg.currentlyUsedSize, reg.size) <= 0.8
+                    && reg.size - reg.currentlyUsedSize >= (100ULL*1000ULL)));
+        any |= compacting[r];
+        moved_from[r] = 0;
+    }
+    if (!any) {
         if (solver->conf.verbosity >= 3 || lower_verb)
             verb_print(1, "Not consolidating memory.");
         return;
     }
     const double my_time = cpuTime();
-    new_sz_while_moving = 0;
-
-    //Pointers that will be moved along
-    BASE_DATA_TYPE * const newDataStart = (BASE_DATA_TYPE*)malloc(currentlyUsedSize*sizeof(BASE_DATA_TYPE));
-    BASE_DATA_TYPE * new_ptr = newDataStart;
 
+    //New stacks for the regions being compacted
     assert(sizeof(BASE_DATA_TYPE) % sizeof(Lit) == 0);
+    uint64_t old_size[num_regions];
+    for(uint32_t r = 0; r < num_regions; r++) {
+        old_size[r] = regions[r].size;
+        new_regions[r] = Region();
+        new_regions[r].unit_shift = regions[r].unit_shift + widen[r];
+        if (widen[r]) {
+            verb_print(1, "[mem] offsets of clause region " << r << " widened to "
+                << (sizeof(BASE_DATA_TYPE) << new_regions[r].unit_shift) << "-byte units");
+        }
+        if (!compacting[r] || regions[r].currentlyUsedSize == 0) continue;
+        //Its clauses all go to the shared region
+        if (sharing_irred && r == irred_region) continue;
+        resize_region(new_regions[r], regions[r].currentlyUsedSize);
+    }
 
-    vector<bool> visited(solver->watches.size(), 0);
     for(auto& ws: solver->watches) {
-        move_one_watchlist(ws, newDataStart, new_ptr);
+        move_one_watchlist(ws);
     }
 
-    update_offsets(solver->longIrredCls, newDataStart, new_ptr);
+    update_offsets(solver->longIrredCls);
     for(auto& lredcls: solver->longRedCls) {
-        update_offsets(lredcls, newDataStart, new_ptr);
+        update_offsets(lredcls);
     }
 
     //Fix up propBy
     for (size_t i = 0; i < solver->nVars(); i++) {
-        VarData& vdata = solver->varData[i];
+        auto vdata = solver->varData[i];
         if (vdata.reason.isClause()) {
             if (vdata.removed == Removed::none
                 && solver->decisionLevel() >= vdata.level
@@ -292,38 +460,34 @@ void ClauseAllocator::consolidate(
             ) {
                 Clause* old = ptr(vdata.reason.get_offset());
                 assert(!old->freed());
-                ClOffset new_offset = (*old)[0].toInt();
-                #ifdef LARGE_OFFSETS
-                new_offset += ((uint64_t)(*old)[1].toInt())<<32;
-                #endif
-                vdata.reason = PropBy(new_offset);
+                vdata.reason = PropBy(new_offset_of(vdata.reason.get_offset()));
             } else {
                 vdata.reason = PropBy();
             }
         }
     }
 
-    //Update sizes
-    const uint64_t old_size = size;
-    size = new_ptr-newDataStart;
-    capacity = currentlyUsedSize;
-    currentlyUsedSize = new_sz_while_moving;
-    free(dataStart);
-    dataStart = newDataStart;
+    //Swap in the new stacks
+    for(uint32_t r = 0; r < num_regions; r++) {
+        if (!compacting[r]) continue;
+        free_region(regions[r]);
+        regions[r] = new_regions[r];
+        new_regions[r] = Region();
+        compacting[r] = false;
+    }
 
     const double time_used = cpuTime() - my_time;
     if (solver->conf.verbosity >= 2
         || (lower_verb && solver->conf.verbosity)
     ) {
-        size_t log_2_size = 0;
-        if (size > 0) {
-            //yes, it can be 0 (only binary clauses, for example)
-            log_2_size = std::log2(size);
-        }
+        const char* names[num_regions] = {"irred", "red0", "red1", "red2", "shared"};
         cout << solver->conf.prefix << "[mem] consolidate ";
-        cout << " old-sz: " << print_value_kilo_mega(old_size*sizeof(BASE_DATA_TYPE))
-        << " new-sz: " << print_value_kilo_mega(size*sizeof(BASE_DATA_TYPE))
-        << " new bits offs: " << std::fixed << std::setprecision(2) << log_2_size;
+        for(uint32_t r = 0; r < num_regions; r++) {
+            cout << " " << names[r]
+            << " old-sz: " << print_value_kilo_mega(old_size[r]*sizeof(BASE_DATA_TYPE))
+            << " new-sz: " << print_value_kilo_mega(regions[r].size*sizeof(BASE_DATA_TYPE))
+            << " moved: " << print_value_kilo_mega(moved_from[r]*sizeof(BASE_DATA_TYPE));
+        }
         cout << solver->conf.print_times(time_used)
         << endl;
     }
@@ -336,21 +500,50 @@ void ClauseAllocator::consolidate(
     }
 }
 
-void ClauseAllocator::update_offsets(
-    vector<ClOffset>& offsets,
-    ClOffset* newDataStart,
-    ClOffset*& new_ptr
-) {
+bool ClauseAllocator::must_widen(const Region& reg) const
+{
+    return reg.unit_shift < max_unit_shift && reg.size >= reg.max_size()/2;
+}
+
+bool ClauseAllocator::must_widen() const
+{
+    for(uint32_t r = 0; r < num_regions; r++) {
+        if (r != shared_region && must_widen(regions[r])) return true;
+    }
+    return false;
+}
 
+/**
+@brief Moves all irredundant clauses to the shared region
+
+Must be called at decision level 0, while no other thread uses the shared
+region. The clauses moved are appended, the ones already there stay put.
+*/
+void ClauseAllocator::share_irred(Solver* solver)
+{
+    assert(!regions[shared_region].borrowed);
+    sharing_irred = true;
+    consolidate(solver);
+    sharing_irred = false;
+}
+
+void ClauseAllocator::borrow_shared_region(const ClauseAllocator& owner)
+{
+    assert(regions[shared_region].borrowed || regions[shared_region].size == 0);
+    regions[shared_region] = owner.regions[shared_region];
+    regions[shared_region].borrowed = true;
+}
+
+void ClauseAllocator::update_offsets(vector<ClOffset>& offsets)
+{
     for(ClOffset& offs: offsets) {
+        if (!is_compacting(offs)) continue;
+
         Clause* old = ptr(offs);
         if (!old->reloced) {
-            offs = move_cl(newDataStart, new_ptr, old);
+            offs = move_cl(old);
         } else {
-            offs = (*old)[0].toInt();
-            #ifdef LARGE_OFFSETS
-            offs += ((uint64_t)(*old)[1].toInt())<<32;
-            #endif
+            offs = new_offset_of(offs);
         }
     }
 }
@@ -358,7 +551,35 @@ void ClauseAllocator::update_offsets(
 size_t ClauseAllocator::mem_used() const
 {
     uint64_t mem = 0;
-    mem += capacity*sizeof(BASE_DATA_TYPE);
+    for(const auto& reg: regions) {
+        if (reg.borrowed) continue;
+        mem += reg.capacity*sizeof(BASE_DATA_TYPE);
+    }
+    mem += mem_used_red_stats();
 
     return mem;
 }
+
+void ClauseAllocator::add_ranges(vector<MemRange>& ranges) const
+{
+    for(const auto& reg: regions) {
+        if (reg.capacity == 0 || reg.borrowed) continue;
+        ranges.push_back(MemRange{reg.dataStart, reg.capacity*sizeof(BASE_DATA_TYPE)});
+    }
+}
+
+uint64_t ClauseAllocator::mem_huge_backed() const
+{
+    vector<MemRange> ranges;
+    add_ranges(ranges);
+    std::sort(ranges.begin(), ranges.end(), [](const MemRange& a, const MemRange& b) {
+        return a.start < b.start;
+    });
+    return huge_backed_bytes(ranges);
+}
+
+size_t ClauseAllocator::mem_used_red_stats() const
+{
+    return red_stats_tab.capacity()*sizeof(RedClauseStats)
+        + red_stats_free.capacity()*sizeof(uint32_t);
+}
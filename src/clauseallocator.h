@@ -33,6 +33,7 @@ THE SOFTWARE.
 #include <stdlib.h>
 #include <map>
 #include <vector>
+#include <algorithm>
 
 namespace CMSat {
 
@@ -51,29 +52,87 @@ needed. When instructed, it consolidates the unused space (i.e. clauses free()-e
 Essentially, it is a stack-like allocator for clauses. It is useful to have
 this, because this way, we can address clauses according to their number,
 which is 32-bit, instead of their address, which might be 64-bit
+
+There is one such stack (region) for irredundant clauses and one for each tier
+of redundant clauses. The region is in the top bits of the offset, so offsets
+still fit into ClOffset and Watched. Learnt clauses churn much faster than
+irredundant ones, so consolidation only compacts the regions that have
+fragmented, and leaves the offsets into the other regions untouched.
+
+With a shared irredundant clause database (SolverConf::shared_irred_db), thread
+0 moves its irredundant clauses into the shared region once before solving.
+The clauses there are never moved, freed or reordered, so the other threads
+borrow the region and use them in place, see PropEngine::shared_watch.
+
+The stats only redundant clauses have (RedClauseStats) are not in the clause
+header, but in a side table here, indexed by Clause::red_stats_at.
+
+Offsets start out compact: they count BASE_DATA_TYPE pieces in the region.
+When a region fills half of what its offsets can address, the next
+consolidation widens it: clauses get aligned to twice as large units and the
+offsets count those units instead. So the offsets still fit into 32 bits, small
+instances pay nothing, and very large ones don't run out of offsets.
 */
 class ClauseAllocator {
     public:
         ClauseAllocator();
         ~ClauseAllocator();
 
-        template<class T>
-        Clause* Clause_new(const T& ps, const uint32_t conflictNum, const uint32_t ID)
+        static constexpr uint32_t num_regions = 5;
+        static constexpr uint32_t irred_region = 0;
+        static constexpr uint32_t shared_region = 4;
+        static uint32_t red_region(const uint32_t which_red_array)
         {
+            return 1 + std::min<uint32_t>(which_red_array, 2);
+        }
+
+        template<class T>
+        Clause* Clause_new(
+            const T& ps
+            , const uint32_t conflictNum
+            , const uint32_t ID
+            , const uint32_t region = irred_region
+        ) {
             if (ps.size() > (0x01UL << 28)) {
                 throw CMSat::TooLongClauseError();
             }
 
-            void* mem = allocEnough(ps.size());
-            Clause* real = new (mem) Clause(ps, conflictNum, ID);
+            void* mem = allocEnough(ps.size(), region);
+            Clause* real = new (mem) Clause(ps, ID);
+            if (region != irred_region) {
+                make_red(real);
+                red_stats(real).last_touched_any = conflictNum;
+            }
             return real;
         }
 
+        RedClauseStats& red_stats(const Clause* cl)
+        {
+            assert(cl->red());
+            return red_stats_tab[cl->red_stats_at];
+        }
+        const RedClauseStats& red_stats(const Clause* cl) const
+        {
+            assert(cl->red());
+            return red_stats_tab[cl->red_stats_at];
+        }
+        void make_red(Clause* cl);
+        void make_irred(Clause* cl);
+
+        //Header and side table together, for moving stats between clauses
+        ClauseStats get_stats(const Clause* cl) const;
+        void set_stats(Clause* cl, const ClauseStats& stats);
+
         ClOffset get_offset(const Clause* ptr) const;
+        static bool is_shared(const ClOffset offset)
+        {
+            return (offset >> region_shift) == shared_region;
+        }
 
         inline Clause* ptr(const ClOffset offset) const
         {
-            return (Clause*)(&dataStart[offset]);
+            const Region& reg = regions[offset >> region_shift];
+            return (Clause*)(&reg.dataStart[(offset & in_region_mask) << reg.unit_shift]);
         }
 
         void clauseFree(Clause* c);
@@ -85,43 +144,89 @@ class ClauseAllocator {
             , bool lower_verb = false
         );
 
+        //Some region's offsets are running out, consolidate() should be called
+        //as soon as it's safe
+        bool must_widen() const;
+
+        //Moves all irredundant clauses into the shared region
+        void share_irred(Solver* solver);
+        //Uses the shared region of 'owner' in place. Must be re-done every
+        //time 'owner' may have grown it
+        void borrow_shared_region(const ClauseAllocator& owner);
+
         size_t mem_used() const;
+        size_t mem_used_red_stats() const;
+
+        //Back the regions with transparent huge pages from the next time
+        //they are (re-)allocated
+        void set_hugepages(const bool huge) { use_hugepages = huge; }
+        uint64_t mem_huge_backed() const;
+        //The regions it owns, not the borrowed one
+        void add_ranges(vector<MemRange>& ranges) const;
 
     private:
-        void update_offsets(
-            vector<ClOffset>& offsets,
-            ClOffset* newDataStart,
-            ClOffset*& new_ptr
-        );
-        void move_one_watchlist(
-            watch_subarray& ws, ClOffset* newDataStart, ClOffset*& new_ptr);
+        static constexpr uint32_t region_bits = 3;
+        static constexpr uint32_t region_shift = EFFECTIVELY_USEABLE_BITS - region_bits;
+        static constexpr ClOffset in_region_mask = (((ClOffset)1) << region_shift) - 1;
+        static_assert(num_regions <= (1U << region_bits));
+
+        //Units are at most 2^max_unit_shift pieces. Larger units would waste
+        //too much on padding, at that point one needs -DLARGEMEM=ON
+        static constexpr uint32_t max_unit_shift = 3;
+
+        struct Region {
+            BASE_DATA_TYPE* dataStart = nullptr; ///<Stack starts at this position
+            uint64_t size = 0; ///<The number of BASE_DATA_TYPE datapieces currently used
+            /**
+            @brief Clauses in the stack had this size when they were allocated
+            This my NOT be their current size: the clauses may be shrinked during
+            the running of the solver. Therefore, it is imperative that their orignal
+            size is saved. This way, we can later move clauses around.
+            */
+            uint64_t capacity = 0; ///<The number of BASE_DATA_TYPE datapieces allocated
+            /**
+            @brief The estimated used size of the stack
+            This is incremented by clauseSize each time a clause is allocated, and
+            decremetented by clauseSize each time a clause is deallocated. The
+            problem is, that clauses can shrink, and thus this value will be an
+            overestimation almost all the time
+            */
+            uint64_t currentlyUsedSize = 0;
+            bool huge = false; ///<dataStart is from huge_alloc(), not malloc()
+            bool borrowed = false; ///<Another allocator's, never freed or grown here
+
+            ///Offsets in the region count units of 2^unit_shift pieces
+            uint32_t unit_shift = 0;
+            uint64_t max_size() const; ///<Addressable pieces
+        };
+        Region regions[num_regions];
+
+        //Only valid during consolidate()
+        Region new_regions[num_regions];
+        bool compacting[num_regions];
+        uint64_t moved_from[num_regions]; ///<BASE_DATA_TYPE datapieces moved out of region
+
+        void update_offsets(vector<ClOffset>& offsets);
+        void move_one_watchlist(watch_subarray& ws);
+        ClOffset move_cl(Clause* old);
+        ClOffset new_offset_of(const ClOffset offset) const;
+        bool is_compacting(const ClOffset offset) const
+        {
+            return compacting[offset >> region_shift];
+        }
 
-        ClOffset move_cl(
-            ClOffset* newDataStart
-            , ClOffset*& new_ptr
-            , Clause* old
-        );
+        vector<RedClauseStats> red_stats_tab;
+        vector<uint32_t> red_stats_free; ///<Unused positions in red_stats_tab
+
+        bool use_hugepages = false;
+        bool sharing_irred = false; ///<consolidate() moves irredundant clauses to the shared region
+        void resize_region(Region& reg, const uint64_t newcapacity);
+        void free_region(Region& reg);
 
-        uint32_t new_sz_while_moving;
-        BASE_DATA_TYPE* dataStart; ///<Stack starts at these positions
-        uint64_t size; ///<The number of BASE_DATA_TYPE datapieces currently used in each stack
-        /**
-        @brief Clauses in the stack had this size when they were allocated
-        This my NOT be their current size: the clauses may be shrinked during
-        the running of the solver. Therefore, it is imperative that their orignal
-        size is saved. This way, we can later move clauses around.
-        */
-        uint64_t capacity; ///<The number of BASE_DATA_TYPE datapieces allocated
-        /**
-        @brief The estimated used size of the stack
-        This is incremented by clauseSize each time a clause is allocated, and
-        decremetented by clauseSize each time a clause is deallocated. The
-        problem is, that clauses can shrink, and thus this value will be an
-        overestimation almost all the time
-        */
-        uint64_t currentlyUsedSize;
-
-        void* allocEnough(const uint32_t num_lits);
+        uint32_t region_of(const Clause* ptr) const;
+        uint64_t alloc_in(Region& reg, uint64_t needed);
+        bool must_widen(const Region& reg) const;
+        void* allocEnough(const uint32_t num_lits, const uint32_t region);
 };
 
 } //end namespace
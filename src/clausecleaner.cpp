@@ -228,6 +228,11 @@ void ClauseCleaner::clean_clauses_inter(vector<ClOffset>& cs)
         }
 
         const ClOffset off = *s;
+        //Other threads use it, too
+        if (ClauseAllocator::is_shared(off)) {
+            *ss++ = *s;
+            continue;
+        }
         Clause& cl = *solver->cl_alloc.ptr(off);
 
         const Lit origLit1 = cl[0];
@@ -281,7 +286,7 @@ bool ClauseCleaner::clean_clause(Clause& cl)
     }
 
     if (i != j) {
-        const auto orig_ID = cl.stats.id;
+        const auto orig_ID = cl.id;
         INC_ID(cl);
         cl.shrink(i-j);
         *solver->frat << add << cl << fratchain << orig_ID;
@@ -309,7 +314,7 @@ bool ClauseCleaner::clean_clause(Clause& cl)
     if (i != j) {
         cl.set_strengthened();
         if (cl.size() == 2) {
-            solver->attach_bin_clause(cl[0], cl[1], cl.red(), cl.stats.id);
+            solver->attach_bin_clause(cl[0], cl[1], cl.red(), cl.id);
             return true;
         } else {
             if (cl.red()) {
@@ -392,7 +397,8 @@ bool ClauseCleaner::remove_and_clean_all() {
     #ifndef NDEBUG
     if (solver->okay()) {
         //Once we have cleaned the watchlists
-        //no watchlist whose lit is set may be non-empty
+        //no watchlist whose lit is set may be non-empty,
+        //except for the shared clauses, which are never cleaned
         size_t wsLit = 0;
         for(watch_array::const_iterator
             it = solver->watches.begin(), end = solver->watches.end()
@@ -401,13 +407,17 @@ bool ClauseCleaner::remove_and_clean_all() {
         ) {
             const Lit lit = Lit::toLit(wsLit);
             if (solver->value(lit) != l_Undef) {
-                if (!it->empty()) {
+                const bool only_shared = std::all_of(it->begin(), it->end(),
+                    [](const Watched& w) {
+                        return w.isClause() && ClauseAllocator::is_shared(w.get_offset());
+                    });
+                if (!only_shared) {
                     cout << "ERROR watches size: " << it->size() << endl;
                     for(const auto& w: *it) {
                         cout << "ERROR w: " << w << endl;
                     }
                 }
-                assert(it->empty());
+                assert(only_shared);
             }
         }
     }
@@ -564,7 +574,7 @@ bool ClauseCleaner::full_clean(Clause& cl)
     }
 
     if (cl.size() == 0) {
-        set_unsat_cl_id(cl.stats.id);
+        set_unsat_cl_id(cl.id);
         solver->ok = false;
         return true;
     }
@@ -576,7 +586,7 @@ bool ClauseCleaner::full_clean(Clause& cl)
     }
 
     if (cl.size() == 2) {
-        solver->attach_bin_clause(cl[0], cl[1], cl.red(), cl.stats.id);
+        solver->attach_bin_clause(cl[0], cl[1], cl.red(), cl.id);
         return true;
     }
 
@@ -101,8 +101,8 @@ struct EqCls {
         Clause* cl1 = cl_alloc.ptr(off1);
         Clause* cl2 = cl_alloc.ptr(off2);
 
-        if (cl1->stats.hash_val != cl2->stats.hash_val) {
-            return cl1->stats.hash_val < cl2->stats.hash_val;
+        if (cl1->hash_val != cl2->hash_val) {
+            return cl1->hash_val < cl2->hash_val;
         }
 
         if (cl1->size() != cl2->size()) {
@@ -124,7 +124,7 @@ struct EqCls {
 };
 
 static bool equiv(Clause* cl1, Clause* cl2) {
-    if (cl1->stats.hash_val != cl2->stats.hash_val) {
+    if (cl1->hash_val != cl2->hash_val) {
         return false;
     }
 
@@ -350,7 +350,7 @@ void BreakID::remove_duplicates()
         assert(!cl->get_removed());
         assert(!cl->red());
         std::sort(cl->begin(), cl->end());
-        cl->stats.hash_val = hash_clause(cl->getData(), cl->size());
+        cl->hash_val = hash_clause(cl->getData(), cl->size());
         dedup_cls.push_back(offs);
     }
 
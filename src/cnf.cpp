@@ -124,13 +124,25 @@ void CNF::new_vars(const size_t n)
 
 void CNF::swapVars(const uint32_t which, const int off_by)
 {
-    std::swap(assigns[nVars()-off_by-1], assigns[which]);
-    std::swap(varData[nVars()-off_by-1], varData[which]);
+    const uint32_t other = nVars()-off_by-1;
+    const lbool val = assigns[other];
+    set_var_value(other, assigns[which]);
+    set_var_value(which, val);
+    varData.swap_vars(other, which);
+}
+
+void CNF::rebuild_lit_assigns()
+{
+    lit_assigns.resize(assigns.size()*2);
+    for(uint32_t v = 0; v < assigns.size(); v++) {
+        set_var_value(v, assigns[v]);
+    }
 }
 
 void CNF::enlarge_nonminimial_datastructs(size_t n)
 {
     assigns.insert(assigns.end(), n, l_Undef);
+    lit_assigns.insert(lit_assigns.end(), 2*n, l_Undef);
     unit_cl_IDs.insert(unit_cl_IDs.end(), n, 0);
     unit_cl_XIDs.insert(unit_cl_XIDs.end(), n, 0);
     for(uint32_t i = 0; i < n; i++) {
@@ -151,7 +163,7 @@ void CNF::enlarge_minimal_datastructs(size_t n)
 void CNF::save_on_var_memory()
 {
     //never resize varData --> contains info about what is replaced/etc.
-    //never resize assigns --> contains 0-level assigns
+    //never resize assigns or lit_assigns --> contains 0-level assigns
     //never resize inter_to_outerMain, outer_to_interMain
 
     watches.resize(nVars()*2);
@@ -241,6 +253,7 @@ void CNF::update_vars(
 ) {
     updateArray(varData, inter_to_outer);
     updateArray(assigns, inter_to_outer);
+    rebuild_lit_assigns();
     updateArray(unit_cl_IDs, inter_to_outer);
     updateArray(unit_cl_XIDs, inter_to_outer);
 
@@ -273,6 +286,15 @@ uint64_t CNF::print_mem_used_longclauses(const size_t total_mem) const
         , "%"
     );
 
+    //Already part of the above
+    const uint64_t red_stats_mem = cl_alloc.mem_used_red_stats();
+    print_stats_line("c Mem for learnt cl stats"
+        , red_stats_mem/(1024UL*1024UL)
+        , "MB"
+        , stats_line_percent(red_stats_mem, total_mem)
+        , "%"
+    );
+
     return mem;
 }
 
@@ -625,13 +647,13 @@ bool CNF::no_marked_clauses() const
 {
     for(ClOffset offset: longIrredCls) {
         Clause* cl = cl_alloc.ptr(offset);
-        assert(!cl->stats.marked_clause);
+        assert(!cl->marked_clause);
     }
 
     for(auto& lredcls: longRedCls) {
         for(ClOffset offset: lredcls) {
             Clause* cl = cl_alloc.ptr(offset);
-            assert(!cl->stats.marked_clause);
+            assert(!cl->marked_clause);
         }
     }
 
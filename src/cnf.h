@@ -73,6 +73,8 @@ public:
     CNF(const SolverConf *_conf, std::atomic<bool>* _must_interrupt_inter)
     {
         if (_conf != nullptr) conf = *_conf;
+        cl_alloc.set_hugepages(conf.hugepages);
+        watches.set_hugepages(conf.hugepages);
         mtrand.seed(conf.origSeed);
         frat = new Frat;
         assert(_must_interrupt_inter != nullptr);
@@ -95,7 +97,7 @@ public:
     watch_array watches;
     vec<vec<GaussWatched>> gwatches;
     uint32_t num_sls_called = 0;
-    vector<VarData> varData;
+    VarDataArray varData;
     branch branch_strategy = branch::vsids;
     string branch_strategy_str = "VSIDS";
     string branch_strategy_str_short = "vs";
@@ -187,7 +189,7 @@ public:
     }
     auto level(Lit l) const { return varData[l.var()].level; }
     lbool value (const uint32_t x) const { return assigns[x]; }
-    lbool value (const Lit p) const { return assigns[p.var()] ^ p.sign(); }
+    lbool value (const Lit p) const { return lit_assigns[p.toInt()]; }
     bool must_interrupt_asap() const { return must_interrupt_inter->load(std::memory_order_relaxed); }
     void set_must_interrupt_asap() { must_interrupt_inter->store(true, std::memory_order_relaxed); }
     void unset_must_interrupt_asap() { must_interrupt_inter->store(false, std::memory_order_relaxed); }
@@ -315,6 +317,17 @@ protected:
     virtual void new_vars(const size_t n);
     void test_reflectivity_of_renumbering() const;
     vector<lbool> assigns;
+    //assigns, but indexed by literal, so value(Lit) needs no XOR.
+    //Only change assigns through set_var_value() or, for bulk changes,
+    //rebuild_lit_assigns() afterwards.
+    vector<lbool> lit_assigns;
+    void set_var_value(const uint32_t v, const lbool val)
+    {
+        assigns[v] = val;
+        lit_assigns[2*v] = val;
+        lit_assigns[2*v+1] = val ^ true;
+    }
+    void rebuild_lit_assigns();
 
     vector<uint32_t> outer_to_interMain;
     vector<uint32_t> inter_to_outerMain;
@@ -45,7 +45,7 @@ CommunityFinder::CommunityFinder(Solver* _solver) :
 void CMSat::CommunityFinder::compute()
 {
     //Clean it
-    for(auto& v: solver->varData) {
+    for(auto v: solver->varData) {
         v.community_num = numeric_limits<uint32_t>::max();
     }
 
@@ -132,7 +132,7 @@ void CMSat::CommunityFinder::compute()
         for(auto& offs: cls) {
             Clause* cl = solver->cl_alloc.ptr(offs);
             const uint32_t comms = solver->calc_connects_num_communities(*cl);
-            solver->red_stats_extra[cl->stats.extra_pos].connects_num_communities = comms;
+            solver->red_stats_extra[solver->cl_alloc.red_stats(cl).extra_pos].connects_num_communities = comms;
         }
     }
 
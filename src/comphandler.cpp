@@ -0,0 +1,369 @@
+/*************************************************************
+CryptoMiniSat --- Copyright (C) 2009-2020 Authors of CryptoMiniSat, see AUTHORS file
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+***************************************************************/
+
+
+#include "comphandler.h"
+#include "solver.h"
+#include "varreplacer.h"
+#include "frat.h"
+#include "time_mem.h"
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <queue>
+#include <thread>
+
+using namespace CMSat;
+using std::vector;
+
+CompHandler::CompHandler(Solver* _solver) :
+    solver(_solver)
+{
+}
+
+uint32_t CompHandler::root(uint32_t v)
+{
+    while (parent[v] != v) {
+        parent[v] = parent[parent[v]];
+        v = parent[v];
+    }
+    return v;
+}
+
+void CompHandler::join(uint32_t a, uint32_t b)
+{
+    a = root(a);
+    b = root(b);
+    if (a == b) return;
+    if (a > b) std::swap(a, b);
+    parent[b] = a;
+}
+
+//Puts the literals not set into 'tmp'. Returns false if the clause is satisfied
+template<class T> bool CompHandler::unset_lits(const T& cl)
+{
+    tmp.clear();
+    for(const Lit l: cl) {
+        const lbool val = solver->value(l);
+        if (val == l_True) return false;
+        if (val == l_Undef) tmp.push_back(l);
+    }
+    return true;
+}
+
+bool CompHandler::find_comps()
+{
+    const uint32_t n = solver->nVarsOuter();
+    parent.resize(n);
+    std::iota(parent.begin(), parent.end(), 0);
+
+    for(const ClOffset offs: solver->longIrredCls) {
+        if (!unset_lits(*solver->cl_alloc.ptr(offs))) continue;
+        for(const Lit l: tmp) join(tmp[0].var(), l.var());
+    }
+    for(uint32_t i = 0; i < n*2; i++) {
+        const Lit lit = Lit::toLit(i);
+        for(const Watched& w: solver->watches[lit]) {
+            if (!w.isBin() || w.red() || w.lit2() < lit) continue;
+            if (!unset_lits(std::array<Lit, 2>{lit, w.lit2()})) continue;
+            for(const Lit l: tmp) join(tmp[0].var(), l.var());
+        }
+    }
+    for(const Xor& x: solver->xorclauses) {
+        uint32_t first = var_Undef;
+        for(const uint32_t v: x) {
+            if (solver->varData[v].removed != Removed::none) return false;
+            if (solver->value(v) != l_Undef) continue;
+            if (first == var_Undef) first = v;
+            else join(first, v);
+        }
+    }
+
+    //Size of the components, at their roots
+    local.assign(n, 0);
+    num_comps = 0;
+    largest = 0;
+    uint32_t num_vars = 0;
+    for(uint32_t v = 0; v < n; v++) {
+        if (solver->varData[v].removed != Removed::none || solver->value(v) != l_Undef) continue;
+        num_vars++;
+        uint32_t& sz = local[root(v)];
+        if (sz == 0) num_comps++;
+        sz++;
+        largest = std::max(largest, sz);
+    }
+
+    //Solving most of it anew would only lose what was learnt
+    return num_comps >= 2 && largest <= solver->conf.comp_max_ratio*num_vars;
+}
+
+//The unset literals in 'tmp' go to their part. A redundant clause may be
+//over several parts, then it's left out
+void CompHandler::add_to_part(const bool red)
+{
+    const uint32_t p = part_of[tmp[0].var()];
+    for(const Lit l: tmp) {
+        if (part_of[l.var()] != p) {
+            assert(red);
+            return;
+        }
+    }
+    Part& part = parts[p];
+    for(const Lit l: tmp) part.cls.push_back(Lit(local[l.var()], l.sign()));
+    part.cls.push_back(red ? lit_Error : lit_Undef);
+}
+
+bool CompHandler::make_parts()
+{
+    const uint32_t n = solver->nVarsOuter();
+    vector<std::pair<uint32_t, uint32_t>> comps; //size, root
+    for(uint32_t v = 0; v < n; v++) {
+        if (local[v] != 0) comps.push_back(std::make_pair(local[v], v));
+    }
+    std::sort(comps.begin(), comps.end(), std::greater<>());
+
+    //Largest first, each to the part with the fewest variables so far
+    const size_t num_parts = std::min<size_t>(comps.size(), 4*num_threads());
+    parts.clear();
+    parts.resize(num_parts);
+    part_of.assign(n, var_Undef);
+    std::priority_queue<
+        std::pair<uint64_t, uint32_t>
+        , vector<std::pair<uint64_t, uint32_t>>
+        , std::greater<>> smallest;
+    for(uint32_t p = 0; p < num_parts; p++) smallest.push(std::make_pair(0, p));
+    for(const auto& c: comps) {
+        const auto [sz, p] = smallest.top();
+        smallest.pop();
+        part_of[c.second] = p;
+        smallest.push(std::make_pair(sz + c.first, p));
+    }
+    for(uint32_t v = 0; v < n; v++) {
+        if (solver->varData[v].removed != Removed::none || solver->value(v) != l_Undef) continue;
+        const uint32_t p = part_of[root(v)];
+        part_of[v] = p;
+        local[v] = parts[p].vars.size();
+        parts[p].vars.push_back(v);
+    }
+
+    for(const ClOffset offs: solver->longIrredCls) {
+        if (unset_lits(*solver->cl_alloc.ptr(offs))) add_to_part(false);
+    }
+    for(const auto& lev: solver->longRedCls) {
+        for(const ClOffset offs: lev) {
+            if (unset_lits(*solver->cl_alloc.ptr(offs))) add_to_part(true);
+        }
+    }
+    for(uint32_t i = 0; i < n*2; i++) {
+        const Lit lit = Lit::toLit(i);
+        for(const Watched& w: solver->watches[lit]) {
+            if (!w.isBin() || w.lit2() < lit) continue;
+            if (unset_lits(std::array<Lit, 2>{lit, w.lit2()})) add_to_part(w.red());
+        }
+    }
+    for(const Xor& x: solver->xorclauses) {
+        vector<uint32_t> vars;
+        bool rhs = x.rhs;
+        for(const uint32_t v: x) {
+            if (solver->value(v) == l_Undef) vars.push_back(local[v]);
+            else rhs ^= solver->value(v) == l_True;
+        }
+        if (vars.empty()) {
+            if (rhs) return false;
+            continue;
+        }
+        parts[part_of[x.vars[0]]].xors.push_back(std::make_pair(vars, rhs));
+    }
+
+    for(Lit p: solver->assumptions) {
+        p = solver->varReplacer->get_lit_replaced_with_outer(p);
+        p = solver->map_outer_to_inter(p);
+        if (solver->value(p) == l_True) continue;
+        //The search finds the conflict of these
+        if (solver->value(p) == l_False) return false;
+        parts[part_of[p.var()]].assumps.push_back(Lit(local[p.var()], p.sign()));
+    }
+
+    return true;
+}
+
+size_t CompHandler::num_threads() const
+{
+    if (solver->conf.comp_threads != 0) return solver->conf.comp_threads;
+    return std::max(std::thread::hardware_concurrency(), 1U);
+}
+
+void CompHandler::solve_part(const size_t at, const uint64_t max_confl)
+{
+    Part& part = parts[at];
+    if (stop[at].load(std::memory_order_relaxed)) return;
+
+    SolverConf conf = solver->conf;
+    conf.verbosity = 0;
+    conf.comp_solve = false;
+    conf.sampling_vars.clear();
+    conf.sampling_vars_set = false;
+    conf.max_confl = max_confl;
+    Solver s(&conf, &stop[at]);
+    s.new_external_vars(part.vars.size());
+
+    vector<Lit> lits;
+    bool ok = true;
+    for(const Lit l: part.cls) {
+        if (l != lit_Undef && l != lit_Error) {
+            lits.push_back(l);
+            continue;
+        }
+        ok = s.add_clause_outside(lits, l == lit_Error);
+        lits.clear();
+        if (!ok) break;
+    }
+    for(const auto& x: part.xors) {
+        if (!ok) break;
+        ok = s.add_xor_clause_outside(x.first, x.second);
+    }
+    part.ret = ok ? s.solve_with_assumptions(&part.assumps, false) : l_False;
+
+    if (part.ret == l_True) {
+        part.model = s.get_model();
+    } else if (part.ret == l_False) {
+        part.conflict = s.get_final_conflict();
+        //No need for the others
+        for(size_t i = 0; i < parts.size(); i++) {
+            stop[i].store(true, std::memory_order_relaxed);
+        }
+    }
+    if (s.okay()) {
+        for(const Lit l: s.get_zero_assigned_lits()) {
+            if (l.var() < part.vars.size()) part.units.push_back(l);
+        }
+    }
+}
+
+//Puts the results of the parts together in the solver
+lbool CompHandler::collect()
+{
+    //The units are implied by the clauses of the parts, so they are kept
+    for(const Part& part: parts) {
+        for(const Lit l: part.units) {
+            const Lit lit = Lit(part.vars[l.var()], l.sign());
+            if (solver->value(lit) == l_Undef) {
+                solver->enqueue<false>(lit);
+                stats.units++;
+            }
+        }
+    }
+    solver->ok = solver->propagate<false>().isnullptr();
+    if (!solver->okay()) {
+        return l_False;
+    }
+
+    //An UNSAT part without assumptions makes it UNSAT for good
+    const Part* unsat = nullptr;
+    for(const Part& part: parts) {
+        if (part.ret != l_False) continue;
+        if (unsat == nullptr || part.conflict.empty()) unsat = &part;
+    }
+    if (unsat != nullptr) {
+        solver->conflict.clear();
+        for(const Lit l: unsat->conflict) {
+            solver->conflict.push_back(Lit(unsat->vars[l.var()], l.sign()));
+        }
+        if (solver->conflict.empty()) solver->ok = false;
+        return l_False;
+    }
+
+    for(const Part& part: parts) {
+        if (part.ret != l_True) return l_Undef;
+    }
+    vector<lbool>& model = solver->model;
+    model.assign(solver->nVarsOuter(), l_Undef);
+    for(uint32_t v = 0; v < solver->nVarsOuter(); v++) {
+        if (solver->varData[v].removed != Removed::none) continue;
+        if (solver->value(v) != l_Undef) {
+            model[v] = solver->value(v);
+        } else {
+            model[v] = parts[part_of[v]].model[local[v]];
+        }
+    }
+    return l_True;
+}
+
+bool CompHandler::solve(lbool& status)
+{
+    assert(solver->okay());
+    assert(solver->decisionLevel() == 0);
+    if (solver->frat->enabled()
+        || std::any_of(solver->bnns.begin(), solver->bnns.end(), [](const BNN* b) { return b != nullptr; })
+    ) {
+        return false;
+    }
+
+    //A conflict limit is for every part
+    uint64_t max_confl = solver->conf.max_confl;
+    if (max_confl != std::numeric_limits<uint64_t>::max()) {
+        if (max_confl <= solver->sumConflicts) return false;
+        max_confl -= solver->sumConflicts;
+    }
+
+    const double my_time = cpuTime();
+    if (!find_comps() || !make_parts()) {
+        parts.clear();
+        return false;
+    }
+
+    stop.reset(new std::atomic<bool>[parts.size()]);
+    for(size_t i = 0; i < parts.size(); i++) {
+        stop[i].store(false, std::memory_order_relaxed);
+    }
+
+    //Largest first, so the threads finish at about the same time
+    vector<size_t> order(parts.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](const size_t a, const size_t b) {
+        return parts[a].vars.size() > parts[b].vars.size();
+    });
+    std::atomic<size_t> next{0};
+    pool.run(std::min(num_threads(), parts.size()), [&](const size_t) {
+        for(size_t i = next.fetch_add(1); i < order.size(); i = next.fetch_add(1)) {
+            solve_part(order[i], max_confl);
+        }
+    });
+    status = collect();
+
+    const double time_used = cpuTime() - my_time;
+    stats.num_calls++;
+    stats.num_comps += num_comps;
+    stats.num_parts += parts.size();
+    stats.time += time_used;
+    verb_print(1, "[comp] components: " << num_comps
+        << " parts: " << parts.size()
+        << " largest: " << largest << " vars"
+        << " result: " << status
+        << solver->conf.print_times(time_used));
+    parts.clear();
+
+    return true;
+}
@@ -0,0 +1,118 @@
+/*************************************************************
+CryptoMiniSat --- Copyright (C) 2009-2020 Authors of CryptoMiniSat, see AUTHORS file
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+***************************************************************/
+
+
+#ifndef COMPHANDLER_H
+#define COMPHANDLER_H
+
+#include "solvertypesmini.h"
+#include "threadpool.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace CMSat {
+
+class Solver;
+
+/**
+@brief Solves the parts of the problem that share no variable on their own
+
+Once the problem is simplified, the variables that are not yet set often fall
+into components that no clause connects. The components are found with a
+union-find over the irredundant clauses and XORs, and are put into parts of
+about the same size, a few per thread. Every part is solved by a Solver of its
+own, with the redundant clauses of the solver that are inside the part, and
+the assumptions on its variables. The parts run on a ThreadPool, and once one
+of them is UNSAT, the others are stopped.
+
+The models of the parts make up a model of the simplified problem, that is
+extended by the solver as usual. The units the parts found are kept by the
+solver. The parts are built anew at every call, so it works with clauses
+added between calls, too.
+*/
+class CompHandler
+{
+    public:
+        explicit CompHandler(Solver* solver);
+
+        //Returns false if the problem doesn't split, and then nothing was done.
+        //Otherwise 'status' is the result, and the model or the conflict of
+        //the solver is set, as if it had found it itself
+        bool solve(lbool& status);
+
+        struct Stats {
+            uint64_t num_calls = 0; ///<Calls the problem was split in
+            uint64_t num_comps = 0;
+            uint64_t num_parts = 0;
+            uint64_t units = 0; ///<Found by the parts
+            double time = 0;
+        };
+        const Stats& get_stats() const;
+
+    private:
+        struct Part {
+            std::vector<uint32_t> vars; ///<Variable of the solver, for every variable of the part
+            std::vector<Lit> cls; ///<Each ends with lit_Undef if irredundant, lit_Error if redundant
+            std::vector<std::pair<std::vector<uint32_t>, bool>> xors;
+            std::vector<Lit> assumps;
+            lbool ret = l_Undef;
+            std::vector<lbool> model;
+            std::vector<Lit> conflict;
+            std::vector<Lit> units;
+        };
+
+        bool find_comps();
+        bool make_parts();
+        template<class T> bool unset_lits(const T& cl);
+        void add_to_part(const bool red);
+        void solve_part(const size_t at, const uint64_t max_confl);
+        size_t num_threads() const;
+        lbool collect();
+
+        uint32_t root(uint32_t v);
+        void join(uint32_t a, uint32_t b);
+
+        Solver* solver;
+        ThreadPool pool;
+        std::unique_ptr<std::atomic<bool>[]> stop; ///<Interrupt of every part
+        Stats stats;
+
+        std::vector<uint32_t> parent; ///<Union-find over the variables
+        std::vector<uint32_t> part_of; ///<Part of a variable, var_Undef if it's set or removed
+        std::vector<uint32_t> local; ///<Variable in its part
+        std::vector<Part> parts;
+        std::vector<Lit> tmp;
+        uint32_t num_comps = 0;
+        uint32_t largest = 0; ///<Variables in the largest component
+};
+
+inline const CompHandler::Stats& CompHandler::get_stats() const
+{
+    return stats;
+}
+
+}
+
+#endif //COMPHANDLER_H
@@ -112,13 +112,13 @@ inline uint32_t rnd_uint(std::mt19937_64& mtrand, const uint32_t maximum_inclusi
 #define STATS_DO(x) do {x;} while (0)
 #define INC_ID(cl) \
     do { \
-        auto prev_id = (cl).stats.ID; \
-        (cl).stats.ID = ++solver->clauseID; \
-        if (solver->sqlStats && (cl).stats.is_tracked) solver->sqlStats->update_id(prev_id, (cl).stats.ID); \
+        auto prev_id = (cl).id; \
+        (cl).id = ++solver->clauseID; \
+        if (solver->sqlStats && (cl).is_tracked) solver->sqlStats->update_id(prev_id, (cl).id); \
     } while (0)
 #else
 #define STATS_DO(x) do {} while (0)
-#define INC_ID(cl) do { (cl).stats.id = ++solver->clauseID; } while (0)
+#define INC_ID(cl) do { (cl).id = ++solver->clauseID; } while (0)
 #endif
 // NOTE: xid's are not tracked during stats -- we must have XOR finding etc disabled
 #define INC_XID(x) do { (x).xid = ++solver->clauseXID; } while (0)
@@ -0,0 +1,74 @@
+/*************************************************************
+CryptoMiniSat --- Copyright (C) 2009-2020 Authors of CryptoMiniSat, see AUTHORS file
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+***************************************************************/
+
+#ifndef CPUFEATURES_H
+#define CPUFEATURES_H
+
+#include <cstdint>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define CMS_X86_DISPATCH
+#include <x86intrin.h>
+#endif
+
+namespace CMSat {
+
+// What the CPU we are running on can do. The library is compiled for a
+// baseline ISA, kernels for wider ones are compiled with
+// __attribute__((target(...))) and only called if these are set.
+struct CPUFeatures
+{
+    bool avx2 = false;
+    bool avx512 = false; //AVX-512 F+BW
+    bool avx512_popcnt = false; //AVX-512 VPOPCNTDQ
+};
+
+inline const CPUFeatures& cpu_features()
+{
+    static const CPUFeatures feat = [] {
+        CPUFeatures f;
+        #ifdef CMS_X86_DISPATCH
+        __builtin_cpu_init();
+        f.avx2 = __builtin_cpu_supports("avx2");
+        f.avx512 = __builtin_cpu_supports("avx512f")
+            && __builtin_cpu_supports("avx512bw");
+        f.avx512_popcnt = f.avx512
+            && __builtin_cpu_supports("avx512vpopcntdq");
+        #endif
+        return f;
+    }();
+    return feat;
+}
+
+// Cheap timestamp, for sampled timing of very short code paths
+inline uint64_t cpu_cycles()
+{
+    #ifdef CMS_X86_DISPATCH
+    return __rdtsc();
+    #else
+    return 0;
+    #endif
+}
+
+}
+
+#endif //CPUFEATURES_H
@@ -25,16 +25,19 @@ THE SOFTWARE.
 #include "solver.h"
 #include "frat.h"
 #include "shareddata.h"
+#include "datasync.h"
+#include "threadpool.h"
+#include "cubeconquer.h"
+#include "batchsolve.h"
+#include "numa.h"
 #include "solvertypesmini.h"
 
 #include <fstream>
 #include <cstdint>
 #include <iomanip>
-#include <thread>
 #include <mutex>
 #include <atomic>
 #include <cassert>
-using std::thread;
 using std::vector;
 
 #define CACHE_SIZE 10ULL*1000ULL*1000UL
@@ -79,6 +82,7 @@ namespace CMSat {
         vector<Solver*> solvers;
         SharedData *shared_data = nullptr;
         int which_solved = 0;
+        bool leader_simplified = false; ///<With leader_simplify, thread 0 did its startup simplification
         std::atomic<bool>* must_interrupt;
         bool must_interrupt_needs_delete = false;
 
@@ -107,6 +111,17 @@ namespace CMSat {
         uint64_t previous_sum_propagations = 0;
         uint64_t previous_sum_decisions = 0;
         vector<double> cpu_times;
+
+        //Threads of the solvers, kept between calls
+        ThreadPool pool;
+
+        //Of each query of the last solve_batch()
+        vector<vector<lbool>> batch_models;
+        vector<vector<Lit>> batch_conflicts;
+
+        //With SolverConf::pin_threads, where each thread goes, see plan_placement()
+        vector<vector<int>> thread_cpus;
+        vector<int> thread_nodes;
     };
 }
 
@@ -137,6 +152,7 @@ struct DataForThread
     std::mutex* update_mutex;
     int *which_solved;
     lbool* ret;
+    bool simplified_cls = false; ///<lits_to_add are thread 0's simplified clauses, see fan_out_simplified()
 };
 
 DLL_PUBLIC SATSolver::SATSolver(
@@ -385,6 +401,188 @@ void update_config(SolverConf& conf, unsigned thread_num)
     }
 }
 
+static void set_no_simplify_conf(SolverConf& conf)
+{
+    conf.doRenumberVars = false;
+    conf.simplify_at_startup = false;
+    conf.simplify_at_every_startup = false;
+    conf.full_simplify_at_startup = false;
+    conf.perform_occur_based_simp = false;
+    conf.do_simplify_problem = false;
+}
+
+static bool actually_add_clauses_to_threads(CMSatPrivateData* data);
+
+//Settings every thread but the first one gets, and that depend on the mode
+//of all threads
+static void set_thread_conf(SolverConf& conf, const unsigned thread_num)
+{
+    if (thread_num >= 1) {
+        conf.verbosity = 0;
+        conf.doFindXors = 0;
+        //Thread 0 has the threads for them
+        conf.comp_solve = false;
+    }
+    if (conf.shared_irred_db) {
+        //The shared clauses must never change, nor be propagated by
+        //anything other than propagate()
+        set_no_simplify_conf(conf);
+        conf.doFindXors = 0;
+        conf.do_distill_clauses = false;
+        conf.do_full_probe = false;
+        conf.doIntreeProbe = false;
+        conf.leader_simplify = false;
+    }
+    if (conf.deterministic) {
+        //Which thread gets which cube depends on timing
+        conf.cube_conquer = false;
+    }
+    if (conf.cube_conquer) {
+        //Cubes are over the variables of the user, and all threads solve them
+        conf.shared_irred_db = false;
+        conf.leader_simplify = false;
+        conf.do_bva = false;
+    }
+    if (conf.leader_simplify) {
+        //The simplified clauses must be over the variables of the user
+        conf.do_bva = false;
+        conf.doBreakid = false;
+    }
+}
+
+/**
+@brief Gives a new thread what 'from' knows: its clauses and its best learnt ones
+
+The clauses are got as the user would, so variables eliminated or replaced in
+'from' are all there. With a shared irredundant clause database the long
+irredundant clauses are left out, they are attached at the next solve().
+*/
+static void clone_solver(Solver& from, Solver& to)
+{
+    assert(from.get_num_bva_vars() == 0);
+    to.new_external_vars(from.nVarsOuter());
+
+    const bool skip_long = to.conf.shared_irred_db;
+    vector<Lit> lits;
+    bool is_xor;
+    bool rhs;
+    for(const bool red: {false, true}) {
+        if (red) {
+            from.start_getting_constraints(true, false,
+                numeric_limits<uint32_t>::max(), from.conf.glue_put_lev0_if_below_or_eq);
+        } else {
+            from.start_getting_constraints(false);
+        }
+        while (from.get_next_constraint(lits, is_xor, rhs)) {
+            if (is_xor) {
+                vector<uint32_t> vars;
+                for(const Lit l: lits) vars.push_back(l.var());
+                to.add_xor_clause_outside(vars, rhs);
+            } else if (!(skip_long && !red && lits.size() > 2)) {
+                to.add_clause_outside(lits, red);
+            }
+        }
+        from.end_getting_constraints();
+    }
+}
+
+/**
+@brief Works out the CPUs and the NUMA node of each thread
+
+With pin_threads == 1 every thread gets a core of its own. The cores are taken
+from the nodes in turn, so the threads, and their memory, are spread over all
+nodes. With pin_threads == 2 every thread may run on all cores of one node,
+the nodes are taken in turn.
+*/
+static void plan_placement(CMSatPrivateData* data)
+{
+    data->thread_cpus.clear();
+    data->thread_nodes.clear();
+    const int pin = data->solvers[0]->conf.pin_threads;
+    if (pin == 0) return;
+
+    const vector<NumaNode> nodes = numa_nodes();
+    vector<std::pair<int, int>> cores; //node, cpu
+    for(size_t i = 0; cores.size() < data->solvers.size(); i++) {
+        bool any = false;
+        for(const auto& n: nodes) {
+            if (i < n.cpus.size()) {
+                cores.push_back({n.id, n.cpus[i]});
+                any = true;
+            }
+        }
+        if (!any) break;
+    }
+
+    for(size_t i = 0; i < data->solvers.size(); i++) {
+        if (pin == 1) {
+            const auto& core = cores[i % cores.size()];
+            data->thread_cpus.push_back({core.second});
+            data->thread_nodes.push_back(core.first);
+        } else {
+            const NumaNode& n = nodes[i % nodes.size()];
+            data->thread_cpus.push_back(n.cpus);
+            data->thread_nodes.push_back(n.id);
+        }
+    }
+}
+
+//Called by thread 'tid' before it does anything. Pool threads stay pinned,
+//but thread 0 may be a different thread every time
+static void place_thread(CMSatPrivateData* data, const size_t tid)
+{
+    if (tid >= data->thread_cpus.size()) return;
+    if (!pin_this_thread(data->thread_cpus[tid])) return;
+
+    Solver& s = *data->solvers[tid];
+    const int node = data->thread_nodes[tid];
+    if (s.numa_node != node) {
+        //What it allocates from now on is local anyway
+        if (s.conf.numa_local_mem) numa_move(s.mem_ranges(), node);
+        s.numa_node = node;
+    }
+}
+
+//A per-thread indicator of how well the placement worked
+static void print_numa_stats(CMSatPrivateData* data)
+{
+    if (data->thread_cpus.empty() || data->solvers[0]->conf.verbosity == 0) return;
+    for(size_t i = 0; i < data->solvers.size(); i++) {
+        const Solver& s = *data->solvers[i];
+        uint64_t remote;
+        uint64_t sampled;
+        numa_remote_pages(s.mem_ranges(), s.numa_node, remote, sampled);
+        cout << "c [numa] thread " << i
+        << " node " << s.numa_node
+        << " remote mem: " << std::fixed << std::setprecision(2)
+        << stats_line_percent(remote, sampled) << " % of " << sampled << " pages looked at"
+        << endl;
+    }
+}
+
+//The threads must be told again which threads there are. The clauses shared
+//in the shared irredundant clause database are kept
+static void renew_shared_data(CMSatPrivateData* data)
+{
+    plan_placement(data);
+    SharedData* old = data->shared_data;
+    data->shared_data = new SharedData(data->solvers.size(), data->thread_nodes);
+    if (old != nullptr) {
+        data->shared_data->irred_cls = std::move(old->irred_cls);
+        delete old;
+    }
+    for(Solver* s: data->solvers) {
+        s->set_shared_data(data->shared_data);
+    }
+}
+
+/**
+@brief Sets the number of threads. Can be called again between calls to solve()
+
+Threads beyond 'num' are dropped. New threads get their own configuration as
+always (see update_config()), and a copy of what the thread that solved the
+last call knows, see clone_solver().
+*/
 DLL_PUBLIC void SATSolver::set_num_threads(unsigned num)
 {
     if (num <= 0) {
@@ -392,23 +590,19 @@ DLL_PUBLIC void SATSolver::set_num_threads(unsigned num)
         std::cerr << err << endl;
         throw std::runtime_error(err);
     }
-    if (num == 1) {
+    const size_t old_num = data->solvers.size();
+    if (num == old_num) {
         return;
     }
-    if (data->solvers.size() > 1) {
-        const char err[] = "ERROR: You must call set_num_threads() at most once";
-        std::cerr << err << endl;
-        throw std::runtime_error(err);
-    }
 
-    if (data->solvers[0]->frat->enabled()) {
+    if (num > 1 && data->solvers[0]->frat->enabled()) {
         const char err[] = "ERROR: FRAT cannot be used in multi-threaded mode";
         std::cerr << err << endl;
         throw std::runtime_error(err);
     }
 
-    if (data->cls > 0 || nVars() > 0) {
-        const char err[] = "ERROR: You must first call set_num_threads() and only then add clauses and variables";
+    if (num > 1 && !data->solvers[0]->get_bnns().empty()) {
+        const char err[] = "ERROR: BNN constraints cannot be used in multi-threaded mode";
         std::cerr << err << endl;
         throw std::runtime_error(err);
     }
@@ -420,25 +614,65 @@ DLL_PUBLIC void SATSolver::set_num_threads(unsigned num)
     }
     #endif
 
+    //Everything added so far must be in the threads we keep or copy
+    if (old_num > 1) {
+        actually_add_clauses_to_threads(data);
+    } else {
+        data->solvers[0]->new_vars(data->vars_to_add);
+        data->vars_to_add = 0;
+    }
+
+    if (num < old_num) {
+        for(size_t i = num; i < old_num; i++) {
+            delete data->solvers[i];
+        }
+        data->solvers.resize(num);
+        data->cpu_times.resize(num);
+        data->pool.shrink(num-1);
+        if (data->which_solved >= (int)num) {
+            data->which_solved = 0;
+        }
+        renew_shared_data(data);
+        return;
+    }
+
+    //The thread that solved the last call, unless BVA added variables to it
+    Solver* from = data->solvers[data->which_solved];
+    if (from->get_num_bva_vars() != 0) {
+        from = nullptr;
+        for(Solver* s: data->solvers) {
+            if (s->get_num_bva_vars() == 0) {
+                from = s;
+                break;
+            }
+        }
+    }
+    if (from == nullptr) {
+        const char err[] = "ERROR: threads cannot be added once BVA added variables to all of them";
+        std::cerr << err << endl;
+        throw std::runtime_error(err);
+    }
+
     data->cls_lits.reserve(CACHE_SIZE);
-    for(unsigned i = 1; i < num; i++) {
-        SolverConf conf = data->solvers[0]->getConf();
+    SolverConf conf0 = data->solvers[0]->getConf();
+    set_thread_conf(conf0, 0);
+    data->solvers[0]->setConf(conf0);
+    for(unsigned i = old_num; i < num; i++) {
+        SolverConf conf = conf0;
         update_config(conf, i);
-        data->solvers.push_back(new Solver(&conf, data->must_interrupt));
+        set_thread_conf(conf, i);
+        Solver* s = new Solver(&conf, data->must_interrupt);
+        data->solvers.push_back(s);
         data->cpu_times.push_back(0.0);
-    }
 
-    //set shared data
-    data->shared_data = new SharedData(data->solvers.size());
-    for(unsigned i = 0; i < num; i++) {
-        SolverConf conf = data->solvers[i]->getConf();
-        if (i >= 1) {
-            conf.verbosity = 0;
-            conf.doFindXors = 0;
+        //These threads are started from thread 0's simplified clauses anyway
+        if (conf.leader_simplify) {
+            s->new_external_vars(data->solvers[0]->nVarsOuter());
+        } else {
+            clone_solver(*from, *s);
         }
-        data->solvers[i]->setConf(conf);
-        data->solvers[i]->set_shared_data((SharedData*)data->shared_data);
     }
+    renew_shared_data(data);
 }
 
 struct OneThreadAddCls
@@ -450,7 +684,16 @@ struct OneThreadAddCls
 
     void operator()() {
         Solver& solver = *data_for_thread.solvers[tid];
+        //Only thread 0 gets the clauses of the user, and only the other
+        //threads get its simplified clauses, see fan_out_simplified()
+        if (solver.conf.leader_simplify
+            && (tid == 0) == data_for_thread.simplified_cls
+        ) {
+            return;
+        }
         solver.new_external_vars(data_for_thread.vars_to_add);
+        //Only thread 0 keeps the long clauses, see share_irred_cls()
+        const bool skip_long = tid != 0 && solver.conf.shared_irred_db;
 
         vector<Lit> lits;
         bool ret = true;
@@ -468,6 +711,7 @@ struct OneThreadAddCls
                 ) {
                     lits.push_back(orig_lits[at]);
                 }
+                if (skip_long && lits.size() > 2) continue;
                 ret = solver.add_clause_outside(lits);
             } else {
                 lits.clear();
@@ -504,13 +748,10 @@ static bool actually_add_clauses_to_threads(CMSatPrivateData* data)
         OneThreadAddCls t(data_for_thread, 0);
         t.operator()();
     } else {
-        vector<thread> thds;
-        for(size_t i = 0; i < data->solvers.size(); i++) {
-            thds.push_back(thread(OneThreadAddCls(data_for_thread, i)));
-        }
-        for(std::thread& t: thds){
-            t.join();
-        }
+        data->pool.run(data->solvers.size(), [&](const size_t tid) {
+            place_thread(data, tid);
+            OneThreadAddCls(data_for_thread, tid)();
+        });
     }
     bool ret = (*data_for_thread.ret != l_False);
 
@@ -521,6 +762,81 @@ static bool actually_add_clauses_to_threads(CMSatPrivateData* data)
     return ret;
 }
 
+//With a shared irredundant clause database, thread 0 moves its long
+//irredundant clauses to its shared region, and the other threads attach them
+static void share_irred_cls(CMSatPrivateData* data)
+{
+    Solver& leader = *data->solvers[0];
+    if (leader.okay()) leader.datasync->share_irred_cls();
+    for(size_t i = 1; i < data->solvers.size(); i++) {
+        data->solvers[i]->datasync->use_shared_irred_cls(leader);
+    }
+}
+
+//Add the cached clauses and variables to thread 0 only
+static void add_clauses_to_leader(CMSatPrivateData* data)
+{
+    DataForThread data_for_thread(data);
+    OneThreadAddCls t(data_for_thread, 0);
+    t.operator()();
+
+    data->cls_lits.clear();
+    data->vars_to_add = 0;
+}
+
+/**
+@brief With leader_simplify, only thread 0 does the startup simplification
+
+The other threads are then started afresh from its simplified clauses. These
+are in OUTER numbering, as all variables are kept, so units and binaries are
+shared as usual, and thread 0 can extend a model any thread finds. Once the
+clauses are picked up by the threads (see OneThreadAddCls), the other threads
+run with their own configuration, as always.
+*/
+static void fan_out_simplified(CMSatPrivateData* data)
+{
+    Solver& leader = *data->solvers[0];
+    add_clauses_to_leader(data);
+    if (leader.okay()
+        && leader.conf.do_simplify_problem
+        && (!data->leader_simplified || leader.conf.simplify_at_every_startup)
+    ) {
+        const string& schedule = leader.conf.full_simplify_at_startup ?
+            leader.conf.simplify_schedule_nonstartup : leader.conf.simplify_schedule_startup;
+        leader.simplify_with_assumptions(nullptr, &schedule);
+        data->leader_simplified = true;
+    }
+
+    //What they learnt may not hold for clauses added since
+    for(size_t i = 1; i < data->solvers.size(); i++) {
+        SolverConf conf = data->solvers[i]->getConf();
+        delete data->solvers[i];
+        data->solvers[i] = new Solver(&conf, data->must_interrupt);
+    }
+    delete data->shared_data;
+    data->shared_data = new SharedData(data->solvers.size(), data->thread_nodes);
+    for(Solver* s: data->solvers) {
+        s->set_shared_data(data->shared_data);
+    }
+
+    data->vars_to_add = leader.nVarsOuter();
+    vector<Lit> lits;
+    bool is_xor;
+    bool rhs;
+    leader.start_getting_constraints(false, true);
+    while (leader.get_next_constraint(lits, is_xor, rhs)) {
+        leader.map_inter_to_outer(lits);
+        if (is_xor) {
+            data->cls_lits.push_back(lit_Error);
+            data->cls_lits.push_back(Lit(0, rhs));
+        } else {
+            data->cls_lits.push_back(lit_Undef);
+        }
+        data->cls_lits.insert(data->cls_lits.end(), lits.begin(), lits.end());
+    }
+    leader.end_getting_constraints();
+}
+
 DLL_PUBLIC void SATSolver::set_max_time(double max_time)
 {
   assert(max_time >= 0 && "Cannot set negative limit on running time");
@@ -555,14 +871,67 @@ DLL_PUBLIC void SATSolver::set_default_polarity(bool polarity)
 DLL_PUBLIC void SATSolver::set_no_simplify()
 {
     for (auto & solver : data->solvers) {
-        Solver& s = *solver;
-        s.conf.doRenumberVars = false;
-        s.conf.simplify_at_startup = false;
-        s.conf.simplify_at_every_startup = false;
-        s.conf.full_simplify_at_startup = false;
-        s.conf.perform_occur_based_simp = false;
-        s.conf.do_simplify_problem = false;
+        set_no_simplify_conf(solver->conf);
+    }
+}
+
+DLL_PUBLIC void SATSolver::set_shared_irred_db()
+{
+    if (data->solvers.size() > 1) {
+        const char err[] = "ERROR: set_shared_irred_db() must be called before set_num_threads()";
+        std::cerr << err << endl;
+        throw std::runtime_error(err);
+    }
+    data->solvers[0]->conf.shared_irred_db = true;
+}
+
+DLL_PUBLIC void SATSolver::set_leader_simplify()
+{
+    if (data->solvers.size() > 1) {
+        const char err[] = "ERROR: set_leader_simplify() must be called before set_num_threads()";
+        std::cerr << err << endl;
+        throw std::runtime_error(err);
+    }
+    data->solvers[0]->conf.leader_simplify = true;
+}
+
+DLL_PUBLIC void SATSolver::set_pin_threads(int pin)
+{
+    if (data->solvers.size() > 1) {
+        const char err[] = "ERROR: set_pin_threads() must be called before set_num_threads()";
+        std::cerr << err << endl;
+        throw std::runtime_error(err);
+    }
+    data->solvers[0]->conf.pin_threads = pin;
+}
+
+DLL_PUBLIC void SATSolver::set_cube_and_conquer(uint64_t confl_per_cube)
+{
+    if (data->solvers.size() > 1) {
+        const char err[] = "ERROR: set_cube_and_conquer() must be called before set_num_threads()";
+        std::cerr << err << endl;
+        throw std::runtime_error(err);
+    }
+    data->solvers[0]->conf.cube_conquer = true;
+    data->solvers[0]->conf.cube_confl = confl_per_cube;
+}
+
+DLL_PUBLIC void SATSolver::set_comp_solve(unsigned num_threads)
+{
+    for (auto & solver : data->solvers) {
+        solver->conf.comp_solve = true;
+        solver->conf.comp_threads = num_threads;
+    }
+}
+
+DLL_PUBLIC void SATSolver::set_deterministic()
+{
+    if (data->solvers.size() > 1) {
+        const char err[] = "ERROR: set_deterministic() must be called before set_num_threads()";
+        std::cerr << err << endl;
+        throw std::runtime_error(err);
     }
+    data->solvers[0]->conf.deterministic = true;
 }
 
 DLL_PUBLIC void SATSolver::set_allow_otf_gauss()
@@ -887,6 +1256,18 @@ struct OneThreadCalc
         }
 
 
+        //Only the winner of the last round counts, see DetRounds
+        Solver& solver = *data_for_thread.solvers[tid];
+        if (solver.conf.deterministic) {
+            if (solver.datasync->finish_rounds() == (int)tid && ret != l_Undef) {
+                data_for_thread.update_mutex->lock();
+                *data_for_thread.which_solved = tid;
+                *data_for_thread.ret = ret;
+                data_for_thread.update_mutex->unlock();
+            }
+            return;
+        }
+
         if (ret != l_Undef) {
             data_for_thread.update_mutex->lock();
             *data_for_thread.which_solved = tid;
@@ -946,8 +1327,22 @@ lbool calc(
         (*data->log) << " )" << endl;
     }
 
+    //With leader_simplify, the other threads only know the simplified clauses,
+    //so they can't take assumptions, nor be simplified
+    const bool leader_simp = data->solvers.size() > 1 && data->solvers[0]->conf.leader_simplify;
+    const bool fan_out = leader_simp
+        && todo == Todo::todo_solve
+        && (assumptions == nullptr || assumptions->empty());
+    if (leader_simp && !fan_out) {
+        add_clauses_to_leader(data);
+        data->which_solved = 0;
+    }
+
     //Deal with the single-thread case
-    if (data->solvers.size() == 1) {
+    if (data->solvers.size() == 1 || (leader_simp && !fan_out)) {
+        if (data->thread_cpus.size() != data->solvers.size()) plan_placement(data);
+        place_thread(data, 0);
+        if (data->shared_data) data->shared_data->rounds.start(1);
         data->solvers[0]->new_vars(data->vars_to_add);
         data->vars_to_add = 0;
 
@@ -962,20 +1357,56 @@ lbool calc(
         return ret;
     }
 
-    //Multi-threaded case
-    DataForThread data_for_thread(data, assumptions);
-    vector<thread> thds;
-    for(size_t i = 0 ; i < data->solvers.size() ; i++) {
-        thds.push_back(thread(OneThreadCalc( data_for_thread, i, todo, only_sampling_solution)));
+    //Calls with assumptions are solved by the threads as usual
+    if (data->solvers[0]->conf.cube_conquer
+        && todo == Todo::todo_solve
+        && (assumptions == nullptr || assumptions->empty())
+    ) {
+        actually_add_clauses_to_threads(data);
+        CubeConquer cc(data->solvers, data->pool);
+        const lbool ret = cc.solve(only_sampling_solution, data->which_solved);
+        data->solvers[0]->unset_must_interrupt_asap();
+        for(size_t i = 0; i < data->solvers.size(); i++) {
+            data->cpu_times[i] = cpuTime();
+        }
+        data->okay = data->solvers[data->which_solved]->okay();
+        print_numa_stats(data);
+        return ret;
     }
 
-    for(std::thread& t: thds){
-        t.join();
+    //Multi-threaded case
+    if (data->solvers[0]->conf.shared_irred_db) {
+        //Thread 0 must have all clauses before it can share them
+        actually_add_clauses_to_threads(data);
+        share_irred_cls(data);
     }
+    if (fan_out) fan_out_simplified(data);
+    DataForThread data_for_thread(data, assumptions);
+    data_for_thread.simplified_cls = fan_out;
+    data->shared_data->rounds.start(data->solvers.size());
+    data->pool.run(data->solvers.size(), [&](const size_t tid) {
+        place_thread(data, tid);
+        //Thread 0 extends their models, they must be complete
+        const bool only_sampl = only_sampling_solution && (!fan_out || tid == 0);
+        OneThreadCalc(data_for_thread, tid, todo, only_sampl)();
+    });
     lbool real_ret = *data_for_thread.ret;
 
+    //The result is moved to thread 0, the others are started afresh next time
+    if (fan_out && *data_for_thread.which_solved != 0) {
+        Solver& leader = *data->solvers[0];
+        const Solver& winner = *data->solvers[*data_for_thread.which_solved];
+        if (real_ret == l_True) {
+            leader.extend_model_of_simplified(winner.get_model(), only_sampling_solution);
+        } else if (real_ret == l_False) {
+            leader.add_clause_outside(vector<Lit>());
+        }
+        *data_for_thread.which_solved = 0;
+    }
+
     //This does it for all of them, there is only one must-interrupt
     data_for_thread.solvers[0]->unset_must_interrupt_asap();
+    print_numa_stats(data);
 
     //clear what has been added
     data->cls_lits.clear();
@@ -1026,6 +1457,104 @@ DLL_PUBLIC lbool SATSolver::simplify(const vector< Lit >* assumptions, const str
     return calc(assumptions, Todo::todo_simplify, data, false, strategy);
 }
 
+//Solves the queries one after the other, where the threads can't take them
+//on their own. The limits are kept for all of them, as BatchSolve does
+static vector<lbool> solve_batch_one_by_one(
+    SATSolver& s,
+    CMSatPrivateData* data,
+    const vector<vector<Lit>>& queries
+) {
+    const Solver& leader = *data->solvers[0];
+    const uint64_t confl_budget = leader.conf.max_confl == numeric_limits<uint64_t>::max() ?
+        leader.conf.max_confl : leader.conf.max_confl - std::min(leader.conf.max_confl, leader.sumConflicts);
+    const double max_time = leader.conf.maxTime;
+
+    vector<lbool> results(queries.size(), l_Undef);
+    for(size_t i = 0; i < queries.size(); i++) {
+        if (confl_budget != numeric_limits<uint64_t>::max()) s.set_max_confl(confl_budget);
+        for(Solver* solver: data->solvers) solver->conf.maxTime = max_time;
+        results[i] = s.solve(&queries[i]);
+        if (results[i] == l_True) {
+            data->batch_models[i] = s.get_model();
+        } else if (results[i] == l_False) {
+            data->batch_conflicts[i] = s.get_conflict();
+        } else if (confl_budget == numeric_limits<uint64_t>::max() || cpuTime() >= max_time) {
+            //Not solved for lack of time, not of conflicts
+            break;
+        }
+    }
+    return results;
+}
+
+DLL_PUBLIC vector<lbool> SATSolver::solve_batch(const vector<vector<Lit>>& assumptions)
+{
+    data->batch_models.assign(assumptions.size(), vector<lbool>());
+    data->batch_conflicts.assign(assumptions.size(), vector<Lit>());
+
+    //With leader_simplify the other threads can't take assumptions, and in
+    //the deterministic mode which thread gets which query depends on timing
+    const Solver& leader = *data->solvers[0];
+    if (data->solvers.size() == 1
+        || leader.conf.leader_simplify
+        || leader.conf.deterministic
+        || data->sql > 0
+    ) {
+        return solve_batch_one_by_one(*this, data, assumptions);
+    }
+
+    if (data->promised_single_call
+        && (data->num_solve_simplify_calls > 0 || assumptions.size() > 1)
+    ) {
+        cout
+        << "ERROR: You promised to only call solve/simplify() once"
+        << "       by calling set_single_run(), but you violated it. Exiting."
+        << endl;
+        exit(-1);
+    }
+    data->num_solve_simplify_calls++;
+    data->previous_sum_conflicts = get_sum_conflicts();
+    data->previous_sum_propagations = get_sum_propagations();
+    data->previous_sum_decisions = get_sum_decisions();
+    data->must_interrupt->store(false, std::memory_order_relaxed);
+    if (data->timeout != numeric_limits<double>::max()) {
+        for(Solver* s: data->solvers) {
+            s->conf.maxTime = cpuTime() + data->timeout;
+        }
+    }
+    if (data->log) {
+        for(const auto& a: assumptions) {
+            (*data->log) << "c Solver::solve( " << a << " )" << endl;
+        }
+    }
+
+    actually_add_clauses_to_threads(data);
+    if (leader.conf.shared_irred_db) share_irred_cls(data);
+    vector<lbool> results;
+    BatchSolve batch(data->solvers, data->pool);
+    batch.solve(assumptions, results, data->batch_models, data->batch_conflicts, data->which_solved);
+
+    //This does it for all of them, there is only one must-interrupt
+    data->solvers[0]->unset_must_interrupt_asap();
+    for(size_t i = 0; i < data->solvers.size(); i++) {
+        data->cpu_times[i] = cpuTime();
+    }
+    data->okay = data->solvers[data->which_solved]->okay();
+    print_numa_stats(data);
+    return results;
+}
+
+DLL_PUBLIC const vector<lbool>& SATSolver::get_batch_model(size_t i) const
+{
+    assert(i < data->batch_models.size());
+    return data->batch_models[i];
+}
+
+DLL_PUBLIC const vector<Lit>& SATSolver::get_batch_conflict(size_t i) const
+{
+    assert(i < data->batch_conflicts.size());
+    return data->batch_conflicts[i];
+}
+
 DLL_PUBLIC const vector< lbool >& SATSolver::get_model() const
 {
     return data->solvers[data->which_solved]->get_model();
@@ -1524,6 +2053,15 @@ DLL_PUBLIC void SATSolver::set_renumber(const bool renumber)
     }
 }
 
+DLL_PUBLIC void SATSolver::set_hugepages(const bool huge)
+{
+    for(auto& s: data->solvers) {
+        s->conf.hugepages = huge;
+        s->cl_alloc.set_hugepages(huge);
+        s->watches.set_hugepages(huge);
+    }
+}
+
 DLL_PUBLIC std::vector<uint32_t> SATSolver::remove_definable_by_irreg_gate(const vector<uint32_t>& vars)
 {
     return data->solvers[0]->remove_definable_by_irreg_gate(vars);
@@ -86,6 +86,9 @@ namespace CMSat {
         lbool simplify(const std::vector<Lit>* assumptions = nullptr, const std::string* strategy = nullptr); //simplify the problem, optionally with assumptions
         const std::vector<lbool>& get_model() const; //get model that satisfies the problem. Only makes sense if previous solve()/simplify() call was l_True
         const std::vector<Lit>& get_conflict() const; //get conflict in terms of the assumptions given in case the previous call to solve() was l_False
+        std::vector<lbool> solve_batch(const std::vector<std::vector<Lit>>& assumptions); //solve under each set of assumptions, as that many calls to solve() would, in parallel on the threads, which share what they learn. The conflict limit is for each set, the time limit for all of them
+        const std::vector<lbool>& get_batch_model(size_t i) const; //model of the i-th set of assumptions of the last solve_batch(), if it was l_True
+        const std::vector<Lit>& get_batch_conflict(size_t i) const; //conflict of the i-th set of assumptions of the last solve_batch(), if it was l_False
         bool okay() const; //the problem is still solveable, i.e. the empty clause hasn't been derived
         const std::vector<Lit>& get_decisions_reaching_model() const; //get decisions that lead to model. may NOT work, in case the decisions needed were internal, extended variables. exit(-1)'s in case of such a case. you MUST check decisions_reaching_computed().
 
@@ -109,7 +112,7 @@ namespace CMSat {
         // -- be very brittle.
         ////////////////////////////
 
-        void set_num_threads(unsigned n); //Number of threads to use. Must be set before any vars/clauses are added
+        void set_num_threads(unsigned n); //Number of threads to use. Can be changed between calls to solve(), new threads copy the one that solved last
         void set_allow_otf_gauss(); //allow on-the-fly gaussian elimination
         /**
          * CPU time (in seconds) that can be consumed before the next call to solve() must return
@@ -132,6 +135,12 @@ namespace CMSat {
         void set_polarity_mode(CMSat::PolarityMode mode); //set polarity type
         CMSat::PolarityMode get_polarity_mode() const;
         void set_no_simplify(); //never simplify
+        void set_shared_irred_db(); //threads share the long irredundant clauses, never simplify. Call before set_num_threads()
+        void set_leader_simplify(); //only thread 0 simplifies at startup, the others start from its result. Call before set_num_threads()
+        void set_pin_threads(int pin); //0: the OS places threads, 1: each on its own core, spread over NUMA nodes, 2: each on a NUMA node. Thread 0 is the calling thread. Call before set_num_threads()
+        void set_cube_and_conquer(uint64_t confl_per_cube = 5000); //threads solve cubes, split when they take more conflicts. Only for calls without assumptions. Call before set_num_threads()
+        void set_comp_solve(unsigned num_threads = 0); //solve the components of the simplified problem on their own, on this many threads, 0 is one per core
+        void set_deterministic(); //same seed and number of threads always give the same result and model, at some cost in speed. Turns off cube-and-conquer. Call before set_num_threads()
         void set_no_simplify_at_startup(); //doesn't simplify at start, faster startup time
         void set_no_equivalent_lit_replacement(); //don't replace equivalent literals
         void set_no_bva(); //No bounded variable addition
@@ -160,6 +169,7 @@ namespace CMSat {
         void set_max_red_linkin_size(uint32_t sz);
         void set_seed(const uint32_t seed);
         void set_renumber(const bool renumber);
+        void set_hugepages(const bool huge); //back clause arena & watches with transparent huge pages (Linux)
         void set_weaken_time_limitM(const uint32_t lim);
         void set_picosat_gate_limitK(const uint32_t lim);
         void set_picosat_confl_limit(const uint32_t lim);
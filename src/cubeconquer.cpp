@@ -0,0 +1,246 @@
+/*************************************************************
+CryptoMiniSat --- Copyright (C) 2009-2020 Authors of CryptoMiniSat, see AUTHORS file
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+***************************************************************/
+
+
+#include "cubeconquer.h"
+#include "solver.h"
+#include "threadpool.h"
+#include "time_mem.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <limits>
+
+using namespace CMSat;
+using std::vector;
+
+CubeConquer::CubeConquer(vector<Solver*>& _solvers, ThreadPool& _pool) :
+    solvers(_solvers)
+    , pool(_pool)
+    , queues(_solvers.size())
+{
+}
+
+//Breadth-first, so the cubes are about the same size
+void CubeConquer::split_at_start()
+{
+    Solver& s = *solvers[0];
+    const size_t want = std::max<size_t>(s.conf.cube_init_mult, 1)*solvers.size();
+    std::deque<Cube> cubes;
+    cubes.push_back(Cube());
+    size_t tries = cubes.size();
+    while (!cubes.empty() && cubes.size() < want && tries > 0) {
+        Cube cube = std::move(cubes.front());
+        cubes.pop_front();
+        tries--;
+        if (!cube.split) {
+            cubes.push_back(std::move(cube));
+            continue;
+        }
+
+        const Lit l = s.cube_split_lit(cube.lits);
+        if (l == lit_Error) {
+            num_failed_lookahead++;
+            continue;
+        }
+        if (l == lit_Undef) {
+            cube.split = false;
+            cubes.push_back(std::move(cube));
+            continue;
+        }
+        Cube other = cube;
+        cube.lits.push_back(l);
+        other.lits.push_back(~l);
+        cubes.push_back(std::move(cube));
+        cubes.push_back(std::move(other));
+        num_split++;
+        tries = cubes.size();
+    }
+
+    pending = cubes.size();
+    for(size_t i = 0; i < cubes.size(); i++) {
+        queues[i % queues.size()].push_back(std::move(cubes[i]));
+    }
+}
+
+bool CubeConquer::get_cube(const size_t tid, Cube& cube)
+{
+    std::unique_lock<std::mutex> lock(mu);
+    while (true) {
+        if (stop) return false;
+        if (!queues[tid].empty()) {
+            cube = std::move(queues[tid].back());
+            queues[tid].pop_back();
+            return true;
+        }
+
+        size_t from = tid;
+        for(size_t i = 0; i < queues.size(); i++) {
+            if (queues[i].size() > queues[from].size()) from = i;
+        }
+        if (from != tid) {
+            cube = std::move(queues[from].front());
+            queues[from].pop_front();
+            num_stolen++;
+            return true;
+        }
+        cv.wait(lock);
+    }
+}
+
+void CubeConquer::refuted()
+{
+    std::lock_guard<std::mutex> lock(mu);
+    num_solved++;
+    assert(pending > 0);
+    pending--;
+    if (pending == 0 && !stop) {
+        stop = true;
+        result = l_False;
+        cv.notify_all();
+    }
+}
+
+void CubeConquer::finish(const lbool res, const size_t tid)
+{
+    std::lock_guard<std::mutex> lock(mu);
+    if (stop) return;
+    stop = true;
+    result = res;
+    winner = tid;
+    //will interrupt all of them
+    solvers[0]->set_must_interrupt_asap();
+    cv.notify_all();
+}
+
+//The cube ran out of its budget. Its halves are more likely solved in time
+void CubeConquer::split(const size_t tid, Cube& cube)
+{
+    const Lit l = solvers[tid]->cube_split_lit(cube.lits);
+    if (l == lit_Error) {
+        {
+            std::lock_guard<std::mutex> lock(mu);
+            num_failed_lookahead++;
+        }
+        refuted();
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mu);
+    if (l == lit_Undef) {
+        cube.split = false;
+        queues[tid].push_back(std::move(cube));
+    } else {
+        Cube other = cube;
+        cube.lits.push_back(l);
+        other.lits.push_back(~l);
+        //'cube' is taken next, lookahead put the side more likely to fail there
+        queues[tid].push_back(std::move(other));
+        queues[tid].push_back(std::move(cube));
+        pending++;
+        num_split++;
+    }
+    cv.notify_all();
+}
+
+void CubeConquer::work(const size_t tid, const bool only_sampling_solution)
+{
+    Solver& s = *solvers[tid];
+    //The limits of the call, the budget of a cube is within them
+    const uint64_t max_confl = s.conf.max_confl;
+    const double max_time = s.conf.maxTime;
+
+    Cube cube;
+    while (get_cube(tid, cube)) {
+        s.conf.max_confl = max_confl;
+        if (cube.split && s.sumConflicts + s.conf.cube_confl > s.sumConflicts) {
+            s.conf.max_confl = std::min(max_confl, s.sumConflicts + s.conf.cube_confl);
+        }
+        s.conf.maxTime = max_time;
+        const lbool ret = s.solve_with_assumptions(&cube.lits, only_sampling_solution);
+
+        if (ret == l_True || (ret == l_False && !s.okay())) {
+            finish(ret, tid);
+            break;
+        }
+        if (ret == l_False) {
+            refuted();
+            continue;
+        }
+        if (s.must_interrupt_asap()
+            || s.sumConflicts >= max_confl
+            || cpuTime() >= max_time
+        ) {
+            finish(l_Undef, tid);
+            break;
+        }
+        split(tid, cube);
+    }
+
+    //As after any solve()
+    s.conf.max_confl = std::numeric_limits<uint64_t>::max();
+    s.conf.maxTime = std::numeric_limits<double>::max();
+}
+
+lbool CubeConquer::solve(const bool only_sampling_solution, int& which_solved)
+{
+    const double my_time = cpuTime();
+    Solver& leader = *solvers[0];
+    for(size_t i = 0; i < solvers.size(); i++) {
+        if (!solvers[i]->okay()) {
+            which_solved = i;
+            return l_False;
+        }
+    }
+
+    split_at_start();
+    if (pending == 0) {
+        result = l_False;
+    } else {
+        pool.run(solvers.size(), [&](const size_t tid) {
+            work(tid, only_sampling_solution);
+        });
+    }
+
+    which_solved = winner;
+    if (result == l_False && solvers[winner]->okay()) {
+        //All cubes refuted. No thread knows it's UNSAT, nor which
+        //assumptions it's UNSAT under, as there were none
+        for(Solver* s: solvers) {
+            s->add_clause_outside(vector<Lit>());
+            s->conflict.clear();
+        }
+    }
+
+    if (leader.conf.verbosity) {
+        std::ios::fmtflags f(cout.flags());
+        cout << "c [cube] result: " << result
+        << " split: " << num_split
+        << " solved: " << num_solved
+        << " stolen: " << num_stolen
+        << " failed-lookahead: " << num_failed_lookahead
+        << " T: " << std::fixed << std::setprecision(2) << (cpuTime() - my_time)
+        << endl;
+        cout.flags(f);
+    }
+    return result;
+}
@@ -0,0 +1,99 @@
+/*************************************************************
+CryptoMiniSat --- Copyright (C) 2009-2020 Authors of CryptoMiniSat, see AUTHORS file
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+***************************************************************/
+
+
+#ifndef CUBECONQUER_H
+#define CUBECONQUER_H
+
+#include "solvertypesmini.h"
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+namespace CMSat {
+
+class Solver;
+class ThreadPool;
+
+/**
+@brief Cube-and-conquer over the threads of a SATSolver
+
+Thread 0 first splits the problem into a few cubes per thread by lookahead,
+see Solver::cube_split_lit(). Every thread then solves cubes as assumptions,
+with a conflict budget for each. A cube that runs out of its budget is split
+in two by the thread that had it, and the halves go to that thread's queue.
+A thread takes the last cube from its own queue, so it goes deeper into what
+it just learnt about, and if that's empty, steals the first, and so largest,
+cube of the fullest queue. The threads share what they learn as in the
+portfolio mode, see DataSync.
+
+The problem is UNSAT once all cubes are refuted, and SAT once a thread finds
+a model of a cube.
+*/
+class CubeConquer
+{
+    public:
+        CubeConquer(std::vector<Solver*>& solvers, ThreadPool& pool);
+
+        //All threads must have all clauses. 'which_solved' is set to the
+        //thread whose model or conflict it is
+        lbool solve(const bool only_sampling_solution, int& which_solved);
+
+    private:
+        struct Cube {
+            std::vector<Lit> lits; ///<In OUTER numbering
+            bool split = true; ///<False if lookahead found nothing to split on
+        };
+
+        void split_at_start();
+        void work(const size_t tid, const bool only_sampling_solution);
+        bool get_cube(const size_t tid, Cube& cube);
+        void split(const size_t tid, Cube& cube);
+        void refuted();
+        void finish(const lbool res, const size_t tid);
+
+        std::vector<Solver*>& solvers;
+        ThreadPool& pool;
+
+        std::mutex mu;
+        std::condition_variable cv;
+
+        //Guarded by 'mu'
+        std::vector<std::deque<Cube>> queues;
+        uint64_t pending = 0; ///<Cubes not yet refuted, queued or being solved
+        bool stop = false;
+        lbool result = l_Undef;
+        int winner = 0;
+
+        //Stats, guarded by 'mu'
+        uint64_t num_solved = 0;
+        uint64_t num_split = 0;
+        uint64_t num_stolen = 0;
+        uint64_t num_failed_lookahead = 0;
+};
+
+}
+
+#endif //CUBECONQUER_H
@@ -27,6 +27,7 @@ THE SOFTWARE.
 
 #include <iostream>
 #include <iomanip>
+#include <algorithm>
 
 //#define VERBOSE_DEBUG_MPI_SENDRCV
 
@@ -68,30 +69,115 @@ void DataSync::set_shared_data(SharedData* _sharedData)
 {
     sharedData = _sharedData;
     thread_id = _sharedData->cur_thread_id++;
+    if (solver->conf.share_long_cls) {
+        sharedData->long_cls[thread_id].reset(
+            new ClauseRing(std::max(solver->conf.share_long_buf_size, 1024U)));
+        //Only this thread writes it
+        numa_move({sharedData->long_cls[thread_id]->mem_range()}, sharedData->node_of(thread_id));
+    }
+    units_copy = sharedData->units_copy(thread_id);
+    longReadAt.assign(sharedData->long_cls.size(), 0);
+    binReadAt.assign(sharedData->bin_logs.size(), BinLog::Cursor());
     #ifdef USE_MPI
     set_up_for_mpi();
     #endif
 }
 
-void DataSync::new_var(const bool bva)
+/**
+@brief Thread 0 moves its long irredundant clauses to where all threads can use them
+
+They are attached as any other clause is, with c[0] and c[1] watched. The
+ones shared at an earlier call stay where they are.
+*/
+void DataSync::share_irred_cls()
 {
-    if (!enabled())
-        return;
+    assert(thread_id == 0);
+    assert(solver->decisionLevel() == 0);
+    solver->cl_alloc.share_irred(solver);
 
-    if (!bva) {
-        syncFinish.push_back(0);
-        syncFinish.push_back(0);
+    for(const ClOffset offs: solver->longIrredCls) {
+        Clause* cl = solver->cl_alloc.ptr(offs);
+        assert(ClauseAllocator::is_shared(offs));
+        if (cl->shared_at != numeric_limits<uint32_t>::max()) continue;
+
+        cl->shared_at = sharedData->irred_cls.size();
+        sharedData->irred_cls.push_back(offs);
+        solver->shared_watch.push_back(PropEngine::SharedWatch{0, 1});
     }
-    assert(solver->nVarsOuter()*2 == syncFinish.size());
+    verb_print(1, "[shared-irred] clauses shared: " << sharedData->irred_cls.size()
+        << " mem used by the clauses of thread 0: "
+        << print_value_kilo_mega(solver->cl_alloc.mem_used()));
 }
 
-void DataSync::new_vars(size_t n)
+/**
+@brief Another thread starts to use the clauses thread 0 shared
+
+This thread never added the long clauses, so it also copies the units and
+binaries thread 0 got from them while they were added.
+*/
+void DataSync::use_shared_irred_cls(const Solver& leader)
 {
-    if (!enabled())
+    assert(thread_id != 0);
+    assert(solver->decisionLevel() == 0);
+    if (!solver->okay()) return;
+    if (!leader.okay()) {
+        solver->ok = false;
         return;
+    }
+    assert(leader.nVars() == solver->nVars());
+    solver->cl_alloc.borrow_shared_region(leader.cl_alloc);
 
-    syncFinish.insert(syncFinish.end(), 2*n, 0);
-    assert(solver->nVarsOuter()*2 == syncFinish.size());
+    tmpLits.resize(1);
+    for(uint32_t i = 0; i < leader.trail.size() && solver->okay(); i++) {
+        tmpLits[0] = leader.trail[i].lit;
+        solver->add_clause_int(tmpLits, false, nullptr, true, nullptr, false);
+    }
+
+    tmpLits.resize(2);
+    for(uint32_t i = 0; i < leader.nVars()*2 && solver->okay(); i++) {
+        const Lit lit = Lit::toLit(i);
+        assert(toClear.empty());
+        for(const Watched& w: solver->watches[lit]) {
+            if (w.isBin() && !w.red()) {
+                toClear.push_back(w.lit2());
+                seen[w.lit2().toInt()] = true;
+            }
+        }
+        for(const Watched& w: leader.watches[lit]) {
+            if (!w.isBin() || w.red() || w.lit2() < lit || seen[w.lit2().toInt()]) {
+                continue;
+            }
+            tmpLits[0] = lit;
+            tmpLits[1] = w.lit2();
+            solver->add_clause_int(tmpLits, false, nullptr, true, nullptr, false);
+            if (!solver->okay()) break;
+        }
+        for (const Lit l: toClear) {
+            seen[l.toInt()] = false;
+        }
+        toClear.clear();
+    }
+
+    const vector<ClOffset>& cls = sharedData->irred_cls;
+    for(size_t i = solver->shared_watch.size(); i < cls.size() && solver->okay(); i++) {
+        if (!solver->attach_shared_clause(cls[i])) {
+            solver->ok = false;
+            break;
+        }
+        solver->longIrredCls.push_back(cls[i]);
+        solver->litStats.irredLits += solver->cl_alloc.ptr(cls[i])->size();
+    }
+    if (solver->okay()) {
+        solver->ok = solver->propagate<false>().isnullptr();
+    }
+}
+
+void DataSync::new_var([[maybe_unused]] const bool bva)
+{
+}
+
+void DataSync::new_vars([[maybe_unused]] size_t n)
+{
 }
 
 void DataSync::save_on_var_memory()
@@ -106,6 +192,9 @@ void DataSync::updateVars(
 
 bool DataSync::syncData()
 {
+    if (enabled() && solver->conf.deterministic) {
+        return sync_in_round();
+    }
     if (!enabled()
         || lastSyncConf + solver->conf.sync_every_confl >= solver->sumConflicts
     ) {
@@ -116,12 +205,8 @@ bool DataSync::syncData()
     assert(sharedData != nullptr);
     assert(solver->decisionLevel() == 0);
 
-    //SEND data
-    bool ok;
-    sharedData->unit_mutex.lock();
-    ok = shareUnitData();
-    sharedData->unit_mutex.unlock();
-    if (!ok) {
+    //None of these take a lock, see SharedData
+    if (!shareUnitData()) {
         return false;
     }
     solver->ok = solver->propagate<false>().isnullptr();
@@ -129,13 +214,11 @@ bool DataSync::syncData()
         return false;
     }
 
-    //RECEIVE data
-    sharedData->bin_mutex.lock();
-    extend_bins_if_needed();
-    clear_set_binary_values();
-    ok = shareBinData();
-    sharedData->bin_mutex.unlock();
-    if (!ok) {
+    if (!shareBinData()) {
+        return false;
+    }
+
+    if (!shareLongData()) {
         return false;
     }
 
@@ -143,22 +226,18 @@ bool DataSync::syncData()
     if (solver->conf.is_mpi
         && solver->conf.thread_num == 0)
     {
-        if (syncMPIFinish.size() < solver->nVarsOutside()*2) {
-            syncMPIFinish.resize(solver->nVarsOutside()*2, 0);
+        if (syncMPIFinish.size() < sharedData->bin_logs.size()) {
+            syncMPIFinish.resize(sharedData->bin_logs.size());
         }
 
         if (!mpi_get_interrupt()) {
-            sharedData->unit_mutex.lock();
-            sharedData->bin_mutex.lock();
-            ok = mpi_recv_from_others();
+            bool ok = mpi_recv_from_others();
             assert(solver->conf.every_n_mpi_sync > 0);
             if (ok &&
                 numCalls % solver->conf.every_n_mpi_sync == solver->conf.every_n_mpi_sync-1
             ) {
                 mpi_send_to_others();
             }
-            sharedData->unit_mutex.unlock();
-            sharedData->bin_mutex.unlock();
             if (!ok) {
                 return false;
             }
@@ -171,6 +250,102 @@ bool DataSync::syncData()
     return true;
 }
 
+/**
+@brief syncData() with SolverConf::deterministic, see DetRounds
+
+Units and binaries are only written to the shared data in the first half of
+the round. Learnt long clauses are written as they are learnt, but nobody
+reads them outside of a round, so the same ones are read either way.
+*/
+bool DataSync::sync_in_round()
+{
+    if (stopped_by != -1) {
+        return true;
+    }
+    const uint64_t props = solver->propStats.bogoProps;
+    round_props += props >= props_seen ? props - props_seen : props;
+    props_seen = props;
+    //Short rounds first, so a short call is not held up by a long
+    //round of the threads that didn't finish
+    if (round_len == 0) {
+        round_len = std::max<uint64_t>(solver->conf.det_round_props/1024, 1);
+    }
+    if (round_props < round_len) {
+        return true;
+    }
+    round_props = 0;
+    round_len = std::min(round_len*2, solver->conf.det_round_props);
+    numCalls++;
+    assert(solver->decisionLevel() == 0);
+
+    publish_units();
+    syncBinToOthers();
+    const int winner = sharedData->rounds.wait(thread_id, false);
+    if (winner != -1) {
+        //Everyone is waiting for the round, so stopping them all now
+        //changes nothing in what they did before it
+        stopped_by = winner;
+        solver->set_must_interrupt_asap();
+        return true;
+    }
+
+    //Whatever happens, the second half must be waited for
+    bool ok = !sharedData->units.clash();
+    if (ok) ok = shareUnitData();
+    if (ok) {
+        solver->ok = solver->propagate<false>().isnullptr();
+        ok = solver->ok;
+    }
+    if (ok) ok = shareBinData();
+    if (ok) ok = shareLongData();
+    if (!ok) solver->ok = false;
+    sharedData->rounds.wait(thread_id, false);
+
+    return ok;
+}
+
+/**
+@brief With SolverConf::deterministic, the last round of a thread that has
+returned from solving
+
+Returns the thread that won, the one whose result counts.
+*/
+int DataSync::finish_rounds()
+{
+    if (!enabled()) {
+        return thread_id;
+    }
+    round_props = 0;
+    round_len = 0;
+    if (stopped_by != -1) {
+        const int winner = stopped_by;
+        stopped_by = -1;
+        return winner;
+    }
+    return sharedData->rounds.wait(thread_id, true);
+}
+
+//First half of a round: our units, whoever sets a variable first
+void DataSync::publish_units()
+{
+    if (!solver->okay()) {
+        return;
+    }
+    SharedUnits& shared = sharedData->units;
+    for (uint32_t var = 0; var < solver->nVarsOuter(); var++) {
+        Lit lit = Lit(var, false);
+        lit = solver->varReplacer->get_lit_replaced_with_outer(lit);
+        lit = solver->map_outer_to_inter(lit);
+        const lbool val = solver->value(lit);
+        //Whoever sets it second marks a different value as a clash, that
+        //everyone finds in the second half
+        if (val != l_Undef && shared.get(var, units_copy) != val) {
+            shared.set(var, val);
+            stats.sentUnitData++;
+        }
+    }
+}
+
 bool DataSync::shareUnitData()
 {
     assert(solver->okay());
@@ -179,18 +354,13 @@ bool DataSync::shareUnitData()
     uint32_t thisGotUnitData = 0;
     uint32_t thisSentUnitData = 0;
 
-    SharedData& shared = *sharedData;
-    if (shared.value.size() < solver->nVarsOuter()) {
-        shared.value.insert(
-            shared.value.end(),
-            solver->nVarsOuter()-shared.value.size(), l_Undef);
-    }
+    SharedUnits& shared = sharedData->units;
     for (uint32_t var = 0; var < solver->nVarsOuter(); var++) {
         Lit thisLit = Lit(var, false);
         thisLit = solver->varReplacer->get_lit_replaced_with_outer(thisLit);
         thisLit = solver->map_outer_to_inter(thisLit);
         const lbool thisVal = solver->value(thisLit);
-        const lbool otherVal = shared.value[var];
+        const lbool otherVal = shared.get(var, units_copy);
 
         if (thisVal == l_Undef && otherVal == l_Undef) {
             continue;
@@ -220,7 +390,11 @@ bool DataSync::shareUnitData()
 
         if (thisVal != l_Undef) {
             assert(otherVal == l_Undef);
-            shared.value[var] = thisVal;
+            //Another thread may have set it since we looked
+            if (shared.set(var, thisVal) != thisVal) {
+                solver->ok = false;
+                return false;
+            }
             thisSentUnitData++;
             continue;
         }
@@ -241,38 +415,165 @@ bool DataSync::shareUnitData()
     return true;
 }
 
-void CMSat::DataSync::signal_new_long_clause(const vector<Lit>& cl)
+void CMSat::DataSync::signal_new_long_clause(const vector<Lit>& cl, const uint32_t glue)
 {
     if (!enabled()) return;
     assert(thread_id != -1);
-    if (cl.size() == 2) signal_new_bin_clause(cl[0], cl[1]);
+    if (cl.size() == 2) {
+        signal_new_bin_clause(cl[0], cl[1]);
+        return;
+    }
+
+    ClauseRing* ring = sharedData->long_cls[thread_id].get();
+    if (ring == nullptr
+        || cl.size() < 3
+        || cl.size() > solver->conf.share_long_max_size
+        || glue > solver->conf.share_long_max_glue
+        || cl.size() + 2 > ring->capacity()/4
+    ) {
+        return;
+    }
+
+    tmpLits.clear();
+    for(const Lit lit: cl) {
+        if (solver->varData[lit.var()].is_bva) return;
+        tmpLits.push_back(solver->map_inter_to_outer(lit));
+    }
+    ring->push(tmpLits.data(), tmpLits.size(), glue);
+    stats.sentLongData++;
 }
 
-bool DataSync::syncBinFromOthers()
+void DataSync::signal_imported_clause_used()
+{
+    stats.usedLongData++;
+}
+
+bool DataSync::shareLongData()
 {
-    for (uint32_t wsLit = 0; wsLit < sharedData->bins.size(); wsLit++) {
-        if (sharedData->bins[wsLit].data == nullptr) {
+    assert(solver->okay());
+    const uint32_t oldRecvLongData = stats.recvLongData;
+
+    for(uint32_t t = 0; t < sharedData->long_cls.size(); t++) {
+        const ClauseRing* ring = sharedData->long_cls[t].get();
+        if ((int)t == thread_id || ring == nullptr) {
             continue;
         }
 
-        Lit lit1 = Lit::toLit(wsLit);
-        lit1 = solver->varReplacer->get_lit_replaced_with_outer(lit1);
-        lit1 = solver->map_outer_to_inter(lit1);
-        if (solver->varData[lit1.var()].removed != Removed::none
-            || solver->value(lit1.var()) != l_Undef
-        ) {
-            continue;
+        longRecvBuf.clear();
+        if (!ring->read(longReadAt[t], longRecvBuf)) {
+            stats.lostLongData++;
         }
+        for(size_t at = 0; at < longRecvBuf.size(); ) {
+            const uint32_t size = longRecvBuf[at];
+            const uint32_t glue = longRecvBuf[at+1];
+            if (!add_long_from_other(longRecvBuf.data() + at + 2, size, glue)) {
+                return false;
+            }
+            at += size + 2;
+        }
+    }
 
-        vector<Lit>& bins = *sharedData->bins[wsLit].data;
-        watch_subarray ws = solver->watches[lit1];
+    if (solver->conf.verbosity >= 1) {
+        cout
+        << "c [sync " << thread_id << "  ]"
+        << " got longs " << (stats.recvLongData - oldRecvLongData)
+        << " (total: " << stats.recvLongData << ")"
+        << " sent longs (total: " << stats.sentLongData << ")"
+        << " used got longs (total: " << stats.usedLongData << ")"
+        << " lost: " << stats.lostLongData
+        << endl;
+    }
 
-        assert(syncFinish.size() > wsLit);
-        if (bins.size() > syncFinish[wsLit]
-            && !syncBinFromOthers(lit1, bins, syncFinish[wsLit], ws)
+    return true;
+}
+
+//Lits are OUTER, written by another thread
+bool DataSync::add_long_from_other(const uint32_t* lits, const uint32_t size, uint32_t glue)
+{
+    tmpLits.clear();
+    for(uint32_t i = 0; i < size; i++) {
+        Lit lit = Lit::toLit(lits[i]);
+        if (lit.var() >= solver->nVarsOuter()) {
+            return true;
+        }
+        lit = solver->varReplacer->get_lit_replaced_with_outer(lit);
+        lit = solver->map_outer_to_inter(lit);
+        if (solver->varData[lit.var()].removed != Removed::none
+            || solver->varData[lit.var()].is_bva
         ) {
+            return true;
+        }
+        if (solver->value(lit) == l_True) {
+            return true;
+        }
+        tmpLits.push_back(lit);
+    }
+
+    ClauseStats s;
+    s.glue = std::min(glue, size);
+    s.imported = true;
+    s.last_touched_any = solver->sumConflicts;
+    #ifndef FINAL_PREDICTOR
+    if (s.glue <= solver->conf.glue_put_lev0_if_below_or_eq) {
+        s.which_red_array = 0;
+    } else if (s.glue <= solver->conf.glue_put_lev1_if_below_or_eq
+        && solver->conf.glue_put_lev1_if_below_or_eq != 0
+    ) {
+        s.which_red_array = 1;
+    } else {
+        s.which_red_array = 2;
+    }
+    #else
+    s.which_red_array = 2;
+    #endif
+
+    //Don't add FRAT: it would add to the thread data, too
+    stats.recvLongData++;
+    Clause* cl = solver->add_clause_int(tmpLits, true, &s, true, nullptr, false);
+    if (cl) {
+        solver->longRedCls[s.which_red_array].push_back(solver->cl_alloc.get_offset(cl));
+    }
+
+    return solver->okay();
+}
+
+bool DataSync::syncBinFromOthers()
+{
+    //Binaries of the others, in our numbering, grouped by their first literal
+    recvBins.clear();
+    for(uint32_t t = 0; t < sharedData->bin_logs.size(); t++) {
+        if ((int)t == thread_id) {
+            continue;
+        }
+        sharedData->bin_logs[t]->read(binReadAt[t], [&](Lit lit1, Lit lit2) {
+            if (lit1.var() >= solver->nVarsOuter() || lit2.var() >= solver->nVarsOuter()) {
+                return;
+            }
+            lit1 = solver->varReplacer->get_lit_replaced_with_outer(lit1);
+            lit1 = solver->map_outer_to_inter(lit1);
+            lit2 = solver->varReplacer->get_lit_replaced_with_outer(lit2);
+            lit2 = solver->map_outer_to_inter(lit2);
+            if (solver->varData[lit1.var()].removed != Removed::none
+                || solver->varData[lit2.var()].removed != Removed::none
+                || solver->value(lit1) != l_Undef
+                || solver->value(lit2) != l_Undef
+            ) {
+                return;
+            }
+            recvBins.push_back(std::make_pair(lit1, lit2));
+        });
+    }
+    std::sort(recvBins.begin(), recvBins.end());
+
+    for(size_t i = 0; i < recvBins.size(); ) {
+        size_t j = i;
+        while (j < recvBins.size() && recvBins[j].first == recvBins[i].first) {
+            j++;
+        }
+        if (!syncBinFromOthers(recvBins[i].first, recvBins.data() + i, recvBins.data() + j)) {
             return false;
         }
+        i = j;
     }
 
     return true;
@@ -280,15 +581,18 @@ bool DataSync::syncBinFromOthers()
 
 bool DataSync::syncBinFromOthers(
     const Lit lit
-    , const vector<Lit>& bins
-    , uint32_t& finished
-    , watch_subarray ws
+    , const std::pair<Lit, Lit>* begin
+    , const std::pair<Lit, Lit>* end
 ) {
     assert(solver->varReplacer->get_lit_replaced_with(lit) == lit);
     assert(solver->varData[lit.var()].removed == Removed::none);
+    //Earlier ones may have set it
+    if (solver->value(lit) != l_Undef) {
+        return true;
+    }
 
     assert(toClear.empty());
-    for (const Watched& w: ws) {
+    for (const Watched& w: solver->watches[lit]) {
         if (w.isBin()) {
             toClear.push_back(w.lit2());
             assert(seen.size() > w.lit2().toInt());
@@ -297,15 +601,8 @@ bool DataSync::syncBinFromOthers(
     }
 
     vector<Lit> lits(2);
-    for (uint32_t i = finished; i < bins.size(); i++) {
-        Lit otherLit = bins[i];
-        otherLit = solver->varReplacer->get_lit_replaced_with_outer(otherLit);
-        otherLit = solver->map_outer_to_inter(otherLit);
-        if (solver->varData[otherLit.var()].removed != Removed::none
-            || solver->value(otherLit) != l_Undef
-        ) {
-            continue;
-        }
+    for (const auto* bin = begin; bin != end; bin++) {
+        const Lit otherLit = bin->second;
         assert(seen.size() > otherLit.toInt());
         if (!seen[otherLit.toInt()]) {
             stats.recvBinData++;
@@ -315,13 +612,14 @@ bool DataSync::syncBinFromOthers(
             //Don't add FRAT: it would add to the thread data, too
             solver->add_clause_int(lits, true, nullptr, true, nullptr, false);
             if (!solver->okay()) {
-                goto end;
+                break;
             }
+            //Other threads may have sent the same one
+            toClear.push_back(otherLit);
+            seen[otherLit.toInt()] = true;
         }
     }
-    finished = bins.size();
 
-    end:
     for (const Lit l: toClear) {
         seen[l.toInt()] = false;
     }
@@ -339,43 +637,11 @@ void DataSync::syncBinToOthers()
     newBinClauses.clear();
 }
 
-bool DataSync::add_bin_to_threads(Lit lit1, Lit lit2)
+void DataSync::add_bin_to_threads(Lit lit1, Lit lit2)
 {
     assert(lit1 < lit2);
-    if (sharedData->bins[lit1.toInt()].data == nullptr) {
-        return false;
-    }
-
-    vector<Lit>& bins = *sharedData->bins[lit1.toInt()].data;
-    for (const Lit lit : bins) {
-        if (lit == lit2)
-            return false;
-    }
-
-    bins.push_back(lit2);
+    sharedData->bin_logs[thread_id]->push(lit1, lit2);
     stats.sentBinData++;
-    return true;
-}
-
-void DataSync::clear_set_binary_values()
-{
-    for(size_t i = 0; i < solver->nVarsOuter()*2; i++) {
-        Lit lit1 = Lit::toLit(i);
-        lit1 = solver->varReplacer->get_lit_replaced_with_outer(lit1);
-        lit1 = solver->map_outer_to_inter(lit1);
-        if (solver->value(lit1) != l_Undef) {
-            sharedData->bins[i].clear();
-        }
-    }
-}
-
-void DataSync::extend_bins_if_needed()
-{
-    assert(sharedData->bins.size() <= (solver->nVarsOuter())*2);
-    if (sharedData->bins.size() == (solver->nVarsOuter())*2)
-        return;
-
-    sharedData->bins.resize(solver->nVarsOuter()*2);
 }
 
 bool DataSync::shareBinData()
@@ -386,7 +652,7 @@ bool DataSync::shareBinData()
 
     bool ok = syncBinFromOthers();
     syncBinToOthers();
-    size_t mem = sharedData->calc_memory_use_bins();
+    size_t mem = sharedData->bin_logs[thread_id]->mem_used();
 
     if (solver->conf.verbosity >= 1) {
         cout
@@ -537,7 +803,8 @@ bool DataSync::mpi_recv_from_others()
         at++;
         for (uint32_t i = 0; i < num; i++, at++) {
             Lit otherLit = Lit::toLit(buf[at]);
-            thisMpiRecvBinData += add_bin_to_threads(lit, otherLit);
+            add_bin_to_threads(lit, otherLit);
+            thisMpiRecvBinData++;
         }
     }
     mpiRecvBinData += thisMpiRecvBinData;
@@ -585,34 +852,33 @@ void DataSync::mpi_send_to_others()
     #endif
 
     //Set up units
-    assert(solver->nVarsOutside() == sharedData->value.size());
     vector<uint32_t> data;
     data.push_back(solver->nVarsOutside());
     for (uint32_t var = 0; var < solver->nVarsOutside(); var++) {
-        data.push_back(toInt(sharedData->value[var]));
+        data.push_back(toInt(sharedData->units.get(var)));
     }
 
-    //Set up binaries
-    assert(sharedData->bins.size() == solver->nVarsOutside()*2);
+    //Set up binaries, grouped by their first literal
     uint32_t thisMpiSentBinData = 0;
+    vector<std::pair<Lit, Lit> > bins;
+    for(uint32_t t = 0; t < sharedData->bin_logs.size(); t++) {
+        sharedData->bin_logs[t]->read(syncMPIFinish[t], [&](const Lit lit1, const Lit lit2) {
+            bins.push_back(std::make_pair(lit1, lit2));
+        });
+    }
+    std::sort(bins.begin(), bins.end());
     data.push_back(solver->nVarsOutside()*2);
-
+    size_t at = 0;
     for(uint32_t wsLit = 0; wsLit < solver->nVarsOutside()*2; wsLit++) {
-        //Lit lit1 = ~Lit::toLit(wsLit);
-        assert(syncMPIFinish.size() > wsLit);
-        if (sharedData->bins[wsLit].data == nullptr) {
-            data.push_back(0);
-            continue;
+        const size_t start = at;
+        while (at < bins.size() && bins[at].first.toInt() == wsLit) {
+            at++;
         }
-        uint32_t size = sharedData->bins[wsLit].data->size();
-        assert(size >= syncMPIFinish[wsLit]);
-        uint32_t sizeToSend = size - syncMPIFinish[wsLit];
-        data.push_back(sizeToSend);
-        for (uint32_t i = syncMPIFinish[wsLit]; i < size; i++) {
-            data.push_back(sharedData->bins[wsLit].data->at(i).toInt());
+        data.push_back(at - start);
+        for (size_t i = start; i < at; i++) {
+            data.push_back(bins[i].second.toInt());
             thisMpiSentBinData++;
         }
-        syncMPIFinish[wsLit] = size;
     }
     mpiSentBinData += thisMpiSentBinData;
 
@@ -27,6 +27,7 @@ THE SOFTWARE.
 #include "watched.h"
 #include "propby.h"
 #include "watcharray.h"
+#include "shareddata.h"
 #ifdef USE_MPI
 #include "mpi.h"
 #endif //USE_MPI
@@ -46,40 +47,64 @@ class DataSync
         void new_var(const bool bva);
         void new_vars(const size_t n);
         bool syncData();
+        int finish_rounds();
         void save_on_var_memory();
         void updateVars(
            const vector<uint32_t>& outer_to_inter
             , const vector<uint32_t>& inter_to_outer
         );
-        void signal_new_long_clause(const vector<Lit>& clause);
+        void signal_new_long_clause(const vector<Lit>& clause, const uint32_t glue);
+        void signal_imported_clause_used();
+
+        //Shared irredundant clause database, see SharedData::irred_cls.
+        //Only called while no thread is solving
+        void share_irred_cls();
+        void use_shared_irred_cls(const Solver& leader);
 
         struct Stats {
             uint32_t sentUnitData = 0;
             uint32_t recvUnitData = 0;
             uint32_t sentBinData = 0;
             uint32_t recvBinData = 0;
+            uint32_t sentLongData = 0;
+            uint32_t recvLongData = 0;
+            uint32_t usedLongData = 0; ///<Received, and then used in conflict analysis
+            uint32_t lostLongData = 0; ///<Times the buffer of another thread lapped us
         };
         const Stats& get_stats() const;
 
     private:
-        void extend_bins_if_needed();
+        bool sync_in_round();
+        void publish_units();
         bool shareUnitData();
         bool shareBinData();
         bool syncBinFromOthers();
-        bool syncBinFromOthers(const Lit lit, const vector<Lit>& bins, uint32_t& finished, watch_subarray ws);
+        bool syncBinFromOthers(const Lit lit, const std::pair<Lit, Lit>* begin, const std::pair<Lit, Lit>* end);
         void syncBinToOthers();
-        void clear_set_binary_values();
-        bool add_bin_to_threads(const Lit lit1, const Lit lit2);
+        void add_bin_to_threads(const Lit lit1, const Lit lit2);
         void signal_new_bin_clause(Lit lit1, Lit lit2);
+        bool shareLongData();
+        bool add_long_from_other(const uint32_t* lits, const uint32_t size, uint32_t glue);
 
         int thread_id = -1;
+        uint32_t units_copy = 0; ///<The copy of the shared units on our NUMA node
 
         //stuff to sync
         vector<std::pair<Lit, Lit> > newBinClauses;
+        vector<BinLog::Cursor> binReadAt; ///<How far we have read the binaries of each thread
+        vector<std::pair<Lit, Lit> > recvBins;
+        vector<uint64_t> longReadAt; ///<How far we have read the buffer of each thread
+        vector<uint32_t> longRecvBuf;
+        vector<Lit> tmpLits;
 
         //stats
         uint64_t lastSyncConf = 0;
-        vector<uint32_t> syncFinish;
+        //With SolverConf::deterministic. propStats is cleared now and then,
+        //so only what it grew by since we last looked is counted
+        uint64_t round_props = 0; ///<Since the last round
+        uint64_t round_len = 0; ///<Doubles every round of a call, up to det_round_props
+        uint64_t props_seen = 0;
+        int stopped_by = -1; ///<Winner of the round that stopped us, or -1
         Stats stats;
 
         //Other systems
@@ -96,7 +121,7 @@ class DataSync
             const uint32_t var,
             uint32_t& thisGotUnitData
         );
-        vector<uint32_t> syncMPIFinish;
+        vector<BinLog::Cursor> syncMPIFinish; ///<How far each thread's binaries were sent
         MPI_Request   sendReq;
         uint32_t*     mpiSendData = nullptr;
 
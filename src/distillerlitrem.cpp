@@ -147,7 +147,6 @@ bool DistillerLitRem::go_through_clauses(
         //Try to distill clause
         offset2 = try_distill_clause_and_return_new(
             offset
-            , &cl.stats
             , at
         );
 
@@ -237,7 +236,6 @@ bool DistillerLitRem::distill_long_cls_all(
 
 ClOffset DistillerLitRem::try_distill_clause_and_return_new(
     ClOffset offset
-    , const ClauseStats* const stats
     , const uint32_t at
 ) {
     assert(solver->prop_at_head());
@@ -296,7 +294,7 @@ ClOffset DistillerLitRem::try_distill_clause_and_return_new(
     runStats.numClShorten++;
 
     // we have to copy because the re-alloc can invalidate the data
-    ClauseStats backup_stats(*stats);
+    ClauseStats backup_stats = solver->cl_alloc.get_stats(&cl);
     // new clause will inherit this clause's ID
     // so let's set this to 0, this way, when we free() it, it won't be
     // deleted as per cl_last_in_solver
@@ -73,7 +73,6 @@ class DistillerLitRem {
         bool go_through_clauses(vector<ClOffset>& cls, uint32_t at);
         ClOffset try_distill_clause_and_return_new(
             ClOffset offset
-            , const ClauseStats* const stats
             , uint32_t at
         );
         Solver* solver;
@@ -77,8 +77,8 @@ struct ClauseSorterFirstInSolver
         const Clause* cl1 = cl_alloc.ptr(off1);
         const Clause* cl2 = cl_alloc.ptr(off2);
 
-        const auto& extra1 = extras[cl1->stats.extra_pos];
-        const auto& extra2 = extras[cl2->stats.extra_pos];
+        const auto& extra1 = extras[cl_alloc.red_stats(cl1).extra_pos];
+        const auto& extra2 = extras[cl_alloc.red_stats(cl2).extra_pos];
 
         //Correct order if c1 was introduced earlier goes first
         return extra1.introduced_at_conflict < extra2.introduced_at_conflict;
@@ -100,7 +100,7 @@ struct ClauseSorterSmallGlueFirst
         const Clause* cl2 = cl_alloc.ptr(off2);
 
         //Correct order if c1's glue is smaller
-        return cl1->stats.glue < cl2->stats.glue;
+        return cl_alloc.red_stats(cl1).glue < cl_alloc.red_stats(cl2).glue;
     }
 };
 
@@ -119,8 +119,8 @@ struct ClauseSorterBestPredFirst
     {
         const Clause* cl1 = cl_alloc.ptr(off1);
         const Clause* cl2 = cl_alloc.ptr(off2);
-        const auto& ext1 = extra_data[cl1->stats.extra_pos];
-        const auto& ext2 = extra_data[cl2->stats.extra_pos];
+        const auto& ext1 = extra_data[cl_alloc.red_stats(cl1).extra_pos];
+        const auto& ext2 = extra_data[cl_alloc.red_stats(cl2).extra_pos];
 
         if (cl1->size() != cl2->size()) {
             return cl1->size() > cl2->size();
@@ -266,7 +266,8 @@ bool DistillerLong::distill_long_cls_all(
                 ClauseSizeSorterLargestFirst(solver->cl_alloc)
             );
         } else if (solver->conf.distill_sort == 2) {
-            std::sort(offs.begin(), offs.end(), ClauseSorterSmallGlueFirst(solver->cl_alloc));
+            //Irredundant clauses have no glue
+            if (red) std::sort(offs.begin(), offs.end(), ClauseSorterSmallGlueFirst(solver->cl_alloc));
         } else if (solver->conf.distill_sort == 3) {
             #ifdef FINAL_PREDICTOR
             if (red) {
@@ -298,7 +299,7 @@ bool DistillerLong::distill_long_cls_all(
             Clause* cl = solver->cl_alloc.ptr(offs[i]);
             VERBOSE_PRINT("Clause at " << i << " is:  " << *cl);
             bool ok = false;
-            if (!cl->stats.is_ternary_resolvent
+            if (!cl->is_ternary_resolvent
                 && !solver->satisfied(*cl)
             ) {
                 if (also_remove) {
@@ -410,7 +411,7 @@ bool DistillerLong::go_through_clauses(vector<ClOffset>& cls, bool also_remove,
         assert(cl.size() > 2);
 
         //Try to distill clause
-        ClOffset offset2 = try_distill_clause_and_return_new( offset, &cl.stats , also_remove, only_remove);
+        ClOffset offset2 = try_distill_clause_and_return_new(offset, also_remove, only_remove);
 
         if (offset2 != CL_OFFSET_MAX) *j++ = offset2;
     }
@@ -421,8 +422,7 @@ bool DistillerLong::go_through_clauses(vector<ClOffset>& cls, bool also_remove,
 }
 
 ClOffset DistillerLong::try_distill_clause_and_return_new(
-    ClOffset offset, const ClauseStats* const stats,
-    const bool also_remove, const bool only_remove
+    ClOffset offset, const bool also_remove, const bool only_remove
 ) {
     frat_func_start();
     assert(solver->prop_at_head());
@@ -575,7 +575,7 @@ ClOffset DistillerLong::try_distill_clause_and_return_new(
     }
 
     // we have to copy because the re-alloc can invalidate the data
-    ClauseStats backup_stats(*stats);
+    ClauseStats backup_stats = solver->cl_alloc.get_stats(&cl);
     // new clause will inherit this clause's ID
     // so let's set this to 0, this way, when we free() it, it won't be
     // deleted as per cl_last_in_solver
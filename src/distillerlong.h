@@ -70,7 +70,6 @@ class DistillerLong {
     private:
         ClOffset try_distill_clause_and_return_new(
             ClOffset offset
-            , const ClauseStats* const stats
             , const bool also_remove, const bool only_remove
         );
         bool distill_long_cls_all(
@@ -228,7 +228,7 @@ bool DistillerLongWithImpl::remove_or_shrink_clause(Clause& cl, ClOffset& offset
     watch_based_data.remLitBin += thisremLitBin;
     tmpStats.shrinked++;
     timeAvailable -= (long)lits.size()*2 + 50;
-    ClauseStats backup_stats(cl.stats);
+    ClauseStats backup_stats = solver->cl_alloc.get_stats(&cl);
     Clause* c2 = solver->add_clause_int(lits, cl.red(), &backup_stats);
     if (c2 != nullptr) {
         solver->detachClause(offset);
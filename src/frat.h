@@ -164,10 +164,10 @@ public:
     Frat& operator<<(const Clause& cl) override
     {
         if (must_delete_next) {
-            byteDRUPdID(cl.stats.id);
+            byteDRUPdID(cl.id);
             for(const Lit l: cl) byteDRUPd(l);
         } else {
-            byteDRUPaID(cl.stats.id);
+            byteDRUPaID(cl.id);
             for(const Lit l: cl) byteDRUPa(l);
         }
 
@@ -28,6 +28,7 @@ THE SOFTWARE.
 ***********************************************/
 
 #include <algorithm>
+#include <bit>
 #include <iomanip>
 #include <iostream>
 #include <set>
@@ -374,6 +375,32 @@ void EGaussian::xor_in_bdd(const uint32_t a, const uint32_t b)
 }
 
 void EGaussian::eliminate() {
+    if (!solver->frat->enabled()
+        && (uint64_t)num_rows*num_cols >= solver->conf.gaussconf.m4ri_min_cells
+    ) {
+        if (getenv("M4CHK")) {
+            uint32_t nw = num_cols/64 + (bool)(num_cols%64);
+            auto cp = [&](PackedMatrix& d, PackedMatrix& src){ d.resize(num_rows, num_cols); for (uint32_t r = 0; r < num_rows; r++) { d[r].rhs() = src[r].rhs(); for (uint32_t w = 0; w < nw; w++) d[r].mp[w] = src[r].mp[w]; } };
+            PackedMatrix save; cp(save, mat);
+            auto sv = var_has_resp_row; auto sr = reason_mat;
+            eliminate_m4ri();
+            PackedMatrix res; cp(res, mat); auto rv = var_has_resp_row;
+            cp(mat, save); var_has_resp_row = sv; reason_mat = sr;
+            solver->conf.gaussconf.m4ri_min_cells = ~0ULL;
+            eliminate();
+            solver->conf.gaussconf.m4ri_min_cells = 0;
+            for (uint32_t r = 0; r < num_rows; r++) {
+                if (res[r].rhs() != mat[r].rhs()) { cout << "M4BAD rhs " << r << endl; exit(-1);}
+                for (uint32_t w = 0; w < nw; w++) if (res[r].mp[w] != mat[r].mp[w]) { cout << "M4BAD " << r << " " << w << endl; exit(-1);}
+            }
+            if (rv != var_has_resp_row) { cout << "M4BAD resp" << endl; exit(-1);}
+            static uint64_t cnt = 0; if (++cnt <= 3 || cnt % 100 == 0) cerr << "M4OK " << cnt << " " << num_rows << "x" << num_cols << endl;
+            return;
+        }
+        eliminate_m4ri();
+        return;
+    }
+
     PackedMatrix::iterator end_row_it = mat.begin() + num_rows;
     PackedMatrix::iterator rowI = mat.begin();
     uint32_t row_i = 0;
@@ -425,6 +452,102 @@ void EGaussian::eliminate() {
     //print_matrix();
 }
 
+/**
+@brief Gauss-Jordan elimination with the method of four Russians
+
+Gives the very same matrix, row order and responsible rows as the textbook
+eliminate(). Pivots are picked the same way, a block of them at a time, and
+the rows only get the block's pivots XOR-ed in once, through a table of all
+their 2^k combinations. That's one pass over the matrix per k pivots instead
+of one per pivot.
+
+While a block is being picked, the rows below it are not touched. A row's
+bit in the next column is computed from its bits in the block's pivot columns
+instead, as the pivots of a block are kept reduced with respect to each other.
+Rows below the pivots are all zero before the block's first column, so only
+the words from there on are XOR-ed.
+*/
+void EGaussian::eliminate_m4ri()
+{
+    const uint32_t num_words = num_cols/64 + (bool)(num_cols%64);
+
+    //About log2(rows), but the table has to stay in cache
+    uint32_t k = std::clamp<int>((int)std::bit_width(num_rows) - 2, 1, 8);
+    while (k > 1 && ((1ULL << k)*(num_words+1)*sizeof(int64_t)) > (1ULL << 22)) {
+        k--;
+    }
+    PackedMatrix table;
+    table.resize(1U << k, num_cols);
+
+    uint32_t block_cols[8];
+    uint32_t row_i = 0;
+    uint32_t col = 0;
+    while (row_i != num_rows && col != num_cols) {
+        const uint32_t block_row = row_i;
+        const uint32_t from = col/64;
+        uint32_t m = 0;
+
+        //Pick up to k pivots
+        for (; m < k && row_i != num_rows && col != num_cols; col++) {
+            uint32_t found = num_rows;
+            for (uint32_t r = row_i; r < num_rows; r++) {
+                PackedRow row = mat[r];
+                bool bit = row[col];
+                for (uint32_t j = 0; j < m; j++) {
+                    if (row[block_cols[j]]) bit ^= mat[block_row+j][col];
+                }
+                if (bit) {
+                    found = r;
+                    break;
+                }
+            }
+            if (found == num_rows) continue;
+
+            PackedRow row = mat[found];
+            for (uint32_t j = 0; j < m; j++) {
+                if (row[block_cols[j]]) row.xor_in_from(mat[block_row+j], from);
+            }
+            var_has_resp_row[col_to_var[col]] = 1;
+            if (found != row_i) {
+                mat[row_i].swapBoth(mat[found]);
+                std::swap(reason_mat[row_i], reason_mat[found]);
+            }
+
+            PackedRow pivot = mat[row_i];
+            for (uint32_t j = 0; j < m; j++) {
+                PackedRow other = mat[block_row+j];
+                if (other[col]) other.xor_in_from(pivot, from);
+            }
+            block_cols[m++] = col;
+            row_i++;
+        }
+        if (m == 0) break;
+
+        //Table of all combinations of the pivots
+        PackedRow zero = table[0];
+        zero.rhs() = 0;
+        for (uint32_t w = from; w < num_words; w++) zero.mp[w] = 0;
+        for (uint32_t i = 1; i < (1U << m); i++) {
+            table[i].set_xor_from(
+                table[i & (i-1)], mat[block_row + std::countr_zero(i)], from);
+        }
+
+        //Clear the pivot columns in all other rows
+        for (uint32_t r = 0; r < num_rows; r++) {
+            if (r == block_row) {
+                r += m-1;
+                continue;
+            }
+            PackedRow row = mat[r];
+            uint32_t idx = 0;
+            for (uint32_t j = 0; j < m; j++) {
+                idx |= (uint32_t)row[block_cols[j]] << j;
+            }
+            if (idx) row.xor_in_from(table[idx], from);
+        }
+    }
+}
+
 vector<Lit>* EGaussian::get_reason(const uint32_t row, int32_t& out_id) {
     frat_func_start();
     if (!xor_reasons[row].must_recalc) {
@@ -122,6 +122,7 @@ class EGaussian {
 
     //Initialisation
     void eliminate();
+    void eliminate_m4ri();
     void fill_matrix();
     void select_columnorder();
     gret init_adjust_matrix(); // adjust matrix, include watch, check row is zero, etc.
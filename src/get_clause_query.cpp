@@ -176,7 +176,7 @@ bool GetClauseQuery::get_next_constraint(std::vector<Lit>& out, bool& is_xor, bo
                 const ClOffset offs = solver->longRedCls[lev][at_lev[lev]];
                 const Clause* cl = solver->cl_alloc.ptr(offs);
                 if (cl->size() <= max_len
-                    && cl->stats.glue <= max_glue
+                    && solver->cl_alloc.red_stats(cl).glue <= max_glue
                 ) {
                     if (!simplified) out = solver->clause_outer_numbered(*cl);
                     else {out.clear(); for(const auto& l: *cl) out.push_back(l);}
@@ -0,0 +1,259 @@
+/*************************************************************
+CryptoMiniSat --- Copyright (C) 2009-2020 Authors of CryptoMiniSat, see AUTHORS file
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+***************************************************************/
+
+
+#include "hugepages.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#define CMS_HAVE_THP
+//Linux 6.1+, older glibc doesn't know it. Older kernels return EINVAL
+#ifndef MADV_COLLAPSE
+#define MADV_COLLAPSE 25
+#endif
+#endif
+
+using namespace CMSat;
+using std::vector;
+using std::string;
+
+#ifdef CMS_HAVE_THP
+static uintptr_t huge_down(const uintptr_t at)
+{
+    return at & ~(uintptr_t)(huge_page_size - 1);
+}
+#endif
+
+void* CMSat::huge_alloc(size_t bytes)
+{
+    bytes = huge_round(bytes);
+    #ifdef CMS_HAVE_THP
+    //Map a bit more, so an aligned piece can be cut out of it
+    const size_t len = bytes + huge_page_size;
+    char* p = (char*)mmap(nullptr, len, PROT_READ | PROT_WRITE
+        , MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p == MAP_FAILED) return nullptr;
+
+    char* aligned = (char*)huge_down((uintptr_t)p + huge_page_size - 1);
+    if (aligned != p) munmap(p, aligned - p);
+    const size_t tail = (p + len) - (aligned + bytes);
+    if (tail != 0) munmap(aligned + bytes, tail);
+
+    //Failure only means we get normal pages
+    madvise(aligned, bytes, MADV_HUGEPAGE);
+    return aligned;
+    #else
+    return std::aligned_alloc(huge_page_size, bytes);
+    #endif
+}
+
+void* CMSat::huge_realloc(void* p, size_t old_bytes, size_t new_bytes)
+{
+    if (p == nullptr) return huge_alloc(new_bytes);
+    old_bytes = huge_round(old_bytes);
+    new_bytes = huge_round(new_bytes);
+    if (old_bytes == new_bytes) return p;
+
+    #ifdef CMS_HAVE_THP
+    //Resizing in place keeps the alignment and the advice, and needs no copy
+    void* in_place = mremap(p, old_bytes, new_bytes, 0);
+    if (in_place != MAP_FAILED) return in_place;
+    #endif
+
+    void* q = huge_alloc(new_bytes);
+    if (q == nullptr) return nullptr;
+    memcpy(q, p, std::min(old_bytes, new_bytes));
+    huge_free(p, old_bytes);
+    return q;
+}
+
+void CMSat::huge_free(void* p, const size_t bytes)
+{
+    if (p == nullptr) return;
+    #ifdef CMS_HAVE_THP
+    munmap(p, huge_round(bytes));
+    #else
+    (void)bytes;
+    free(p);
+    #endif
+}
+
+#ifdef CMS_HAVE_THP
+//Huge page-aligned spans covering all of 'ranges', sorted and merged
+static vector<MemRange> huge_spans(const vector<MemRange>& ranges)
+{
+    vector<std::pair<uintptr_t, uintptr_t>> spans;
+    for(const auto& r: ranges) {
+        if (r.len == 0) continue;
+        const uintptr_t start = huge_down((uintptr_t)r.start);
+        const uintptr_t end = huge_down((uintptr_t)r.start + r.len - 1) + huge_page_size;
+        //Neighbouring ranges are often in the same huge page
+        if (!spans.empty() && spans.back().first <= start && start <= spans.back().second) {
+            spans.back().second = std::max(spans.back().second, end);
+        } else {
+            spans.push_back({start, end});
+        }
+    }
+    std::sort(spans.begin(), spans.end());
+
+    vector<MemRange> ret;
+    uintptr_t cur_start = 0;
+    uintptr_t cur_end = 0;
+    for(const auto& s: spans) {
+        if (s.first <= cur_end && cur_end != 0) {
+            cur_end = std::max(cur_end, s.second);
+            continue;
+        }
+        if (cur_end != 0) ret.push_back({(const void*)cur_start, cur_end-cur_start});
+        cur_start = s.first;
+        cur_end = s.second;
+    }
+    if (cur_end != 0) ret.push_back({(const void*)cur_start, cur_end-cur_start});
+    return ret;
+}
+
+static uint64_t overlap(const MemRange& r, const uintptr_t start, const uintptr_t end)
+{
+    const uintptr_t r_start = (uintptr_t)r.start;
+    const uintptr_t r_end = r_start + r.len;
+    if (r_end <= start || end <= r_start) return 0;
+    return std::min(r_end, end) - std::max(r_start, start);
+}
+
+//How much of the sorted 'ranges' is between start and end
+static uint64_t bytes_in(const vector<MemRange>& ranges, const uintptr_t start, const uintptr_t end)
+{
+    auto it = std::lower_bound(ranges.begin(), ranges.end(), start,
+        [](const MemRange& r, const uintptr_t at) { return (uintptr_t)r.start < at; });
+    if (it != ranges.begin()) --it;
+
+    uint64_t bytes = 0;
+    for(; it != ranges.end() && (uintptr_t)it->start < end; ++it) {
+        bytes += overlap(*it, start, end);
+    }
+    return bytes;
+}
+
+//Parses the "start-end perms offset dev inode path" header of a mapping
+static bool parse_mapping(const string& line, uintptr_t& start, uintptr_t& end, bool& anon_rw)
+{
+    std::istringstream iss(line);
+    string range, perms, offset, dev, path;
+    uint64_t inode;
+    if (!(iss >> range >> perms >> offset >> dev >> inode)) return false;
+    const size_t dash = range.find('-');
+    if (dash == string::npos || dash == 0) return false;
+    for(const char c: range) {
+        if (c != '-' && !std::isxdigit((unsigned char)c)) return false;
+    }
+    start = std::stoull(range.substr(0, dash), nullptr, 16);
+    end = std::stoull(range.substr(dash+1), nullptr, 16);
+    iss >> path;
+    anon_rw = perms == "rw-p" && inode == 0 && (path.empty() || path == "[heap]");
+    return true;
+}
+#endif
+
+void CMSat::advise_huge(const vector<MemRange>& ranges)
+{
+    #ifdef CMS_HAVE_THP
+    const vector<MemRange> spans = huge_spans(ranges);
+    if (spans.empty()) return;
+
+    //Only advise private anonymous memory (heap, malloc arenas) the spans
+    //touch, never e.g. a library mapped next to the data
+    std::ifstream maps("/proc/self/maps");
+    string line;
+    while (std::getline(maps, line)) {
+        uintptr_t start, end;
+        bool anon_rw;
+        if (!parse_mapping(line, start, end, anon_rw) || !anon_rw) continue;
+        for(const auto& s: spans) {
+            if (overlap(s, start, end) == 0) continue;
+            const uintptr_t from = std::max((uintptr_t)s.start, start);
+            const uintptr_t to = std::min((uintptr_t)s.start + s.len, end);
+            madvise((void*)from, to-from, MADV_HUGEPAGE);
+
+            //The advice only affects pages faulted in later, and the data is
+            //already there. Collapse it now instead of waiting for khugepaged
+            madvise((void*)from, to-from, MADV_COLLAPSE);
+        }
+    }
+    #else
+    (void)ranges;
+    #endif
+}
+
+uint64_t CMSat::huge_backed_bytes(const vector<MemRange>& ranges)
+{
+    uint64_t total = 0;
+    #ifdef CMS_HAVE_THP
+    const vector<MemRange> spans = huge_spans(ranges);
+    if (spans.empty()) return 0;
+
+    std::ifstream smaps("/proc/self/smaps");
+    string line;
+    uint64_t in_mapping = 0;
+    while (std::getline(smaps, line)) {
+        uintptr_t start, end;
+        bool anon_rw;
+        if (line.compare(0, 14, "AnonHugePages:") == 0) {
+            const uint64_t huge = std::stoull(line.substr(14))*1024ULL;
+            total += std::min(huge, in_mapping);
+            in_mapping = 0;
+        } else if (parse_mapping(line, start, end, anon_rw)) {
+            //Other data may share the huge pages, only count our own bytes
+            in_mapping = 0;
+            for(const auto& s: spans) {
+                if (overlap(s, start, end) != 0) {
+                    in_mapping = bytes_in(ranges, start, end);
+                    break;
+                }
+            }
+        }
+    }
+    #else
+    (void)ranges;
+    #endif
+    return total;
+}
+
+const char* CMSat::thp_mode()
+{
+    std::ifstream f("/sys/kernel/mm/transparent_hugepage/enabled");
+    string line;
+    if (!std::getline(f, line)) return "unknown";
+    //The active one is in brackets, e.g. "always [madvise] never"
+    if (line.find("[always]") != string::npos) return "always";
+    if (line.find("[madvise]") != string::npos) return "madvise";
+    if (line.find("[never]") != string::npos) return "never";
+    return "unknown";
+}
@@ -0,0 +1,75 @@
+/*************************************************************
+CryptoMiniSat --- Copyright (C) 2009-2020 Authors of CryptoMiniSat, see AUTHORS file
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+***************************************************************/
+
+
+#ifndef HUGEPAGES_H
+#define HUGEPAGES_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace CMSat {
+
+/**
+@brief Memory backed by transparent huge pages (THP)
+
+Big, randomly accessed arrays (the clause arena, the watchlists) cause a lot of
+TLB misses with 4KB pages. These functions map memory 2MB aligned and ask the
+kernel via madvise(MADV_HUGEPAGE) to back it with huge pages. This needs no
+hugetlbfs set-up, only THP being in "always" or "madvise" mode, which is the
+default on most distributions. If it's not available, it's simply normal memory.
+*/
+static constexpr size_t huge_page_size = 2ULL*1024ULL*1024ULL;
+
+struct MemRange {
+    const void* start;
+    size_t len;
+};
+
+//Rounds up to a whole number of huge pages
+inline size_t huge_round(const size_t bytes)
+{
+    return (bytes + huge_page_size - 1) & ~(huge_page_size - 1);
+}
+
+//Sizes are rounded up to whole huge pages. Return nullptr on failure
+void* huge_alloc(size_t bytes);
+void* huge_realloc(void* p, size_t old_bytes, size_t new_bytes);
+void huge_free(void* p, size_t bytes);
+
+//Advise huge pages for the huge page-sized chunks that 'ranges' (e.g. memory
+//from malloc()) touch, and collapse them into huge pages right away where the
+//kernel supports it. Ranges must be sorted by their start
+void advise_huge(const std::vector<MemRange>& ranges);
+
+//How much of 'ranges' is actually backed by huge pages right now, from
+///proc/self/smaps. Approximate, as smaps only gives it per mapping. Ranges
+//must be sorted by their start
+uint64_t huge_backed_bytes(const std::vector<MemRange>& ranges);
+
+//THP mode of the system: "always", "madvise", "never" or "unknown"
+const char* thp_mode();
+
+}
+
+#endif //HUGEPAGES_H
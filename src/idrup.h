@@ -147,10 +147,10 @@ public:
     {
         if (skipnextclause) return *this;
         if (must_delete_next) {
-            byteDRUPdID(cl.stats.id);
+            byteDRUPdID(cl.id);
             for(const Lit l: cl) byteDRUPd(l);
         } else {
-            byteDRUPaID(cl.stats.id);
+            byteDRUPaID(cl.id);
             for(const Lit l: cl) byteDRUPa(l);
         }
 
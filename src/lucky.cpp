@@ -109,7 +109,7 @@ bool CMSat::Lucky::check_all(bool polar)
     if (solver->conf.verbosity) {
         cout << "c [lucky] all " << (int)polar << " worked. Saving phases." << endl;
     }
-    for(auto& x: solver->varData) {
+    for(auto x: solver->varData) {
         x.best_polarity = polar;
     }
     return true;
@@ -776,6 +776,14 @@ void Main::add_supported_options() {
         .action([&](const auto& a) {conf.diff_declev_for_chrono = std::atoi(a.c_str());})
         .default_value(conf.diff_declev_for_chrono)
         .help("Difference in decision level is more than this, perform chonological backtracking instead of non-chronological backtracking. Giving -1 means it is never turned on (overrides '--confltochrono -1' in this case).");
+    program.add_argument("--propprefetch")
+        .action([&](const auto& a) {conf.prop_prefetch_lookahead = std::atoi(a.c_str());})
+        .default_value(conf.prop_prefetch_lookahead)
+        .help("Prefetch the clauses of this many upcoming watches during propagation. 0 = don't prefetch");
+    program.add_argument("--propsimd")
+        .action([&](const auto& a) {conf.prop_simd = std::atoi(a.c_str());})
+        .default_value(conf.prop_simd)
+        .help("Use AVX2/AVX-512 to find new watches in long clauses, if the CPU supports it");
 
 #ifdef USE_SQLITE3
     /* po::options_description sqlOptions("SQL options"); */
@@ -884,6 +892,10 @@ void Main::add_supported_options() {
         .action([&](const auto& a) {conf.doSaveMem = std::atoi(a.c_str());})
         .default_value(conf.doSaveMem)
         .help("Save memory by deallocating variable space after renumbering. Only works if renumbering is active.");
+    program.add_argument("--hugepages")
+        .action([&](const auto& a) {conf.hugepages = std::atoi(a.c_str());})
+        .default_value(conf.hugepages)
+        .help("Back the clause arena and the watchlists with transparent huge pages (madvise). Needs THP in 'always' or 'madvise' mode, no hugetlbfs");
     program.add_argument("--mustrenumber")
         .action([&](const auto& a) {conf.must_renumber = std::atoi(a.c_str());})
         .default_value(conf.must_renumber)
@@ -920,6 +932,74 @@ void Main::add_supported_options() {
         .action([&](const auto& a) {conf.sync_every_confl = std::atoll(a.c_str());})
         .default_value(conf.sync_every_confl)
         .help("Sync threads every N conflicts");
+    program.add_argument("--sharelong")
+        .action([&](const auto& a) {conf.share_long_cls = std::atoi(a.c_str());})
+        .default_value(conf.share_long_cls)
+        .help("Share short, low-glue learnt clauses between threads, not only units and binaries");
+    program.add_argument("--sharelongsize")
+        .action([&](const auto& a) {conf.share_long_max_size = std::atoi(a.c_str());})
+        .default_value(conf.share_long_max_size)
+        .help("Only share learnt clauses of at most this size");
+    program.add_argument("--sharelongglue")
+        .action([&](const auto& a) {conf.share_long_max_glue = std::atoi(a.c_str());})
+        .default_value(conf.share_long_max_glue)
+        .help("Only share learnt clauses of at most this glue");
+    program.add_argument("--sharelongbuf")
+        .action([&](const auto& a) {conf.share_long_buf_size = std::atoi(a.c_str());})
+        .default_value(conf.share_long_buf_size)
+        .help("Size of the buffer, in 32b words, a thread shares its learnt clauses through. A thread reading too rarely loses the ones overwritten since");
+    program.add_argument("--sharedirred")
+        .action([&](const auto& a) {conf.shared_irred_db = std::atoi(a.c_str());})
+        .default_value(conf.shared_irred_db)
+        .help("Keep the long irredundant clauses only once, used by all threads in place. Turns off simplification");
+    program.add_argument("--leadersimp")
+        .action([&](const auto& a) {conf.leader_simplify = std::atoi(a.c_str());})
+        .default_value(conf.leader_simplify)
+        .help("Only thread 0 simplifies at startup, the other threads start from its simplified CNF. Calls with assumptions run on thread 0 only");
+    program.add_argument("--cubes")
+        .action([&](const auto& a) {conf.cube_conquer = std::atoi(a.c_str());})
+        .default_value(conf.cube_conquer)
+        .help("Cube-and-conquer: split the problem into cubes by lookahead, and solve them on the threads, splitting the ones that take too long. Only for calls without assumptions");
+    program.add_argument("--cubeconfl")
+        .action([&](const auto& a) {conf.cube_confl = std::atoll(a.c_str());})
+        .default_value(conf.cube_confl)
+        .help("Split a cube after this many conflicts spent on it");
+    program.add_argument("--cubecands")
+        .action([&](const auto& a) {conf.cube_cands = std::atoi(a.c_str());})
+        .default_value(conf.cube_cands)
+        .help("Number of the most active variables lookahead tries to split on");
+    program.add_argument("--cubeinit")
+        .action([&](const auto& a) {conf.cube_init_mult = std::atoi(a.c_str());})
+        .default_value(conf.cube_init_mult)
+        .help("Split into this many cubes per thread before the threads start");
+    program.add_argument("--pin")
+        .action([&](const auto& a) {conf.pin_threads = std::atoi(a.c_str());})
+        .default_value(conf.pin_threads)
+        .help("Pin threads. 0 = the OS places them, 1 = each to its own core, spread over the NUMA nodes, 2 = each to the cores of a NUMA node, round-robin");
+    program.add_argument("--numamem")
+        .action([&](const auto& a) {conf.numa_local_mem = std::atoi(a.c_str());})
+        .default_value(conf.numa_local_mem)
+        .help("Move the clauses, watchlists and variable data of a pinned thread to its NUMA node");
+    program.add_argument("--deterministic")
+        .action([&](const auto& a) {conf.deterministic = std::atoi(a.c_str());})
+        .default_value(conf.deterministic)
+        .help("Threads only exchange clauses in rounds, after a fixed number of propagations, so the same seed and number of threads always give the same result and model. Turns off cube-and-conquer");
+    program.add_argument("--detround")
+        .action([&](const auto& a) {conf.det_round_props = std::atoll(a.c_str());})
+        .default_value(conf.det_round_props)
+        .help("With --deterministic, bogoprops a thread does between two rounds");
+    program.add_argument("--comps")
+        .action([&](const auto& a) {conf.comp_solve = std::atoi(a.c_str());})
+        .default_value(conf.comp_solve)
+        .help("Solve the components of the simplified problem, that share no variable, each with a solver of its own, in parallel");
+    program.add_argument("--compthreads")
+        .action([&](const auto& a) {conf.comp_threads = std::atoi(a.c_str());})
+        .default_value(conf.comp_threads)
+        .help("Threads to solve the components on, 0 is one per core");
+    program.add_argument("--compmaxratio")
+        .action([&](const auto& a) {conf.comp_max_ratio = std::atof(a.c_str());})
+        .default_value(conf.comp_max_ratio)
+        .help("Only split into components if the largest one has at most this ratio of the variables");
     program.add_argument("--clearinter")
         .action([&](const auto& a) {need_clean_exit = std::atoi(a.c_str());})
         .default_value(0)
@@ -975,6 +1055,10 @@ void Main::add_supported_options() {
         .action([&](const auto& a) {conf.gaussconf.min_usefulness_cutoff = std::atof(a.c_str());})
         .default_value(conf.gaussconf.min_usefulness_cutoff)
         .help("Turn off Gauss if less than this many usefulenss ratio is recorded");
+    program.add_argument("--m4rimincells")
+        .action([&](const auto& a) {conf.gaussconf.m4ri_min_cells = std::atoll(a.c_str());})
+        .default_value(conf.gaussconf.m4ri_min_cells)
+        .help("Matrices with at least this many cells (rows*columns) are eliminated with the blocked, method of four Russians algorithm");
     program.add_argument("--dumpresult")
         .action([&](const auto& a) {result_fname = a;})
         .help("Write solution(s) to this file");
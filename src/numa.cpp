@@ -0,0 +1,217 @@
+/*************************************************************
+CryptoMiniSat --- Copyright (C) 2009-2020 Authors of CryptoMiniSat, see AUTHORS file
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+***************************************************************/
+
+#include "numa.h"
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#if defined(__linux__)
+#include <sched.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#if defined(SYS_move_pages) && defined(SYS_getcpu)
+#define CMS_HAVE_NUMA
+#endif
+#endif
+
+using namespace CMSat;
+using std::vector;
+using std::string;
+
+#ifdef CMS_HAVE_NUMA
+static constexpr int mpol_mf_move = 1 << 1;
+
+//"0-3,8,10-11" as in /sys
+static vector<int> parse_list(const string& str)
+{
+    vector<int> ret;
+    std::istringstream iss(str);
+    string part;
+    while (std::getline(iss, part, ',')) {
+        if (part.empty() || !std::isdigit((unsigned char)part[0])) continue;
+        const size_t dash = part.find('-');
+        const int from = std::stoi(part.substr(0, dash));
+        const int to = dash == string::npos ? from : std::stoi(part.substr(dash+1));
+        for(int i = from; i <= to; i++) ret.push_back(i);
+    }
+    return ret;
+}
+
+static string read_line(const string& fname)
+{
+    std::ifstream f(fname);
+    string line;
+    std::getline(f, line);
+    return line;
+}
+
+static vector<NumaNode> read_nodes()
+{
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    const bool have_allowed = sched_getaffinity(0, sizeof(allowed), &allowed) == 0;
+
+    vector<NumaNode> nodes;
+    const string dir = "/sys/devices/system/node/";
+    for(const int id: parse_list(read_line(dir + "online"))) {
+        NumaNode n;
+        n.id = id;
+        for(const int cpu: parse_list(read_line(dir + "node" + std::to_string(id) + "/cpulist"))) {
+            if (!have_allowed || (cpu < CPU_SETSIZE && CPU_ISSET(cpu, &allowed))) {
+                n.cpus.push_back(cpu);
+            }
+        }
+        if (!n.cpus.empty()) nodes.push_back(n);
+    }
+    return nodes;
+}
+
+//All pages of 'ranges', only every 'stride'-th one
+static vector<void*> pages_of(const vector<MemRange>& ranges, const uint64_t stride)
+{
+    const uintptr_t page = sysconf(_SC_PAGESIZE);
+    vector<void*> pages;
+    uint64_t at = 0;
+    for(const auto& r: ranges) {
+        if (r.len == 0) continue;
+        const uintptr_t start = (uintptr_t)r.start & ~(page - 1);
+        const uintptr_t end = (uintptr_t)r.start + r.len;
+        for(uintptr_t p = start; p < end; p += page, at++) {
+            if (at % stride == 0) pages.push_back((void*)p);
+        }
+    }
+    return pages;
+}
+
+static uint64_t num_pages(const vector<MemRange>& ranges)
+{
+    const uint64_t page = sysconf(_SC_PAGESIZE);
+    uint64_t num = 0;
+    for(const auto& r: ranges) {
+        num += (r.len + page - 1)/page + 1;
+    }
+    return num;
+}
+#endif
+
+vector<NumaNode> CMSat::numa_nodes()
+{
+    //The CPUs allowed are looked at before any thread is pinned
+    static const vector<NumaNode> nodes = []() {
+        vector<NumaNode> ret;
+        #ifdef CMS_HAVE_NUMA
+        ret = read_nodes();
+        #endif
+        if (ret.empty()) {
+            NumaNode n;
+            n.id = 0;
+            for(unsigned i = 0; i < std::max(std::thread::hardware_concurrency(), 1U); i++) {
+                n.cpus.push_back(i);
+            }
+            ret.push_back(n);
+        }
+        return ret;
+    }();
+    return nodes;
+}
+
+bool CMSat::pin_this_thread(const vector<int>& cpus)
+{
+    #ifdef CMS_HAVE_NUMA
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for(const int cpu: cpus) {
+        if (cpu < CPU_SETSIZE) CPU_SET(cpu, &set);
+    }
+    return sched_setaffinity(0, sizeof(set), &set) == 0;
+    #else
+    (void)cpus;
+    return false;
+    #endif
+}
+
+int CMSat::numa_this_node()
+{
+    #ifdef CMS_HAVE_NUMA
+    unsigned cpu;
+    unsigned node;
+    if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) return node;
+    #endif
+    return -1;
+}
+
+void CMSat::numa_move(const vector<MemRange>& ranges, const int node)
+{
+    #ifdef CMS_HAVE_NUMA
+    if (node < 0) return;
+    vector<void*> pages = pages_of(ranges, 1);
+    //In batches, so the kernel's copy of the arrays stays small
+    const size_t batch = 1U << 12;
+    vector<int> nodes(batch, node);
+    vector<int> status(batch);
+    for(size_t i = 0; i < pages.size(); i += batch) {
+        const size_t num = std::min(batch, pages.size() - i);
+        //Pages that can't be moved stay where they are
+        syscall(SYS_move_pages, 0, num, pages.data() + i, nodes.data(), status.data(), mpol_mf_move);
+    }
+    #else
+    (void)ranges;
+    (void)node;
+    #endif
+}
+
+void CMSat::numa_remote_pages(
+    const vector<MemRange>& ranges
+    , const int node
+    , uint64_t& remote
+    , uint64_t& sampled
+    , const uint64_t max_pages
+) {
+    remote = 0;
+    sampled = 0;
+    #ifdef CMS_HAVE_NUMA
+    if (node < 0 || max_pages == 0) return;
+    vector<void*> pages = pages_of(ranges, std::max<uint64_t>(num_pages(ranges)/max_pages, 1));
+    vector<int> status(pages.size());
+    //With no nodes given, it only tells where the pages are
+    if (pages.empty()
+        || syscall(SYS_move_pages, 0, pages.size(), pages.data(), nullptr, status.data(), 0) != 0
+    ) {
+        return;
+    }
+    for(const int s: status) {
+        //Negative if not mapped in yet
+        if (s < 0) continue;
+        sampled++;
+        remote += s != node;
+    }
+    #else
+    (void)ranges;
+    (void)node;
+    (void)max_pages;
+    #endif
+}
@@ -0,0 +1,73 @@
+/*************************************************************
+CryptoMiniSat --- Copyright (C) 2009-2020 Authors of CryptoMiniSat, see AUTHORS file
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+***************************************************************/
+
+#ifndef CMS_NUMA_H
+#define CMS_NUMA_H
+
+#include "hugepages.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace CMSat {
+
+/**
+@brief NUMA topology, thread pinning and page placement
+
+On machines with several NUMA nodes (e.g. sockets) memory is attached to one of
+them, and reaching it from another one is slower. Linux puts a page on the
+node of the thread that first touches it, so a thread pinned to a node mostly
+allocates locally by itself. Memory touched before, e.g. a thread's clauses
+copied in by another thread, can be moved with move_pages(). These only use
+syscalls and /sys, no libnuma. Where they are not available there is a single
+node, and pinning and moving do nothing.
+*/
+struct NumaNode {
+    int id;
+    std::vector<int> cpus; ///<Only the ones this process may run on
+};
+
+//Nodes with CPUs this process may run on. Never empty
+std::vector<NumaNode> numa_nodes();
+
+//Pins the calling thread to 'cpus'. Returns false if it could not be done
+bool pin_this_thread(const std::vector<int>& cpus);
+
+//Node the calling thread is running on now, -1 if unknown
+int numa_this_node();
+
+//Moves the pages of 'ranges' to 'node', as far as the kernel lets us
+void numa_move(const std::vector<MemRange>& ranges, const int node);
+
+//Looks at up to 'max_pages' pages of 'ranges', evenly spread. 'remote' is set
+//to the number of them on another node than 'node'
+void numa_remote_pages(
+    const std::vector<MemRange>& ranges
+    , const int node
+    , uint64_t& remote
+    , uint64_t& sampled
+    , const uint64_t max_pages = 1024
+);
+
+}
+
+#endif //CMS_NUMA_H
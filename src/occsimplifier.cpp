@@ -405,7 +405,7 @@ bool OccSimplifier::clean_clause(
         }
 
         case 2: {
-            solver->attach_bin_clause(cl[0], cl[1], cl.red(), cl.stats.id);
+            solver->attach_bin_clause(cl[0], cl[1], cl.red(), cl.id);
             if (!cl.red()) {
                 std::pair<Lit, Lit> tmp = {cl[0], cl[1]};
                 added_irred_bin.push_back(tmp);
@@ -464,7 +464,7 @@ bool OccSimplifier::complete_clean_clause(Clause& cl)
 
     switch (cl.size()) {
         case 0: {
-            set_unsat_cl_id(cl.stats.id);
+            set_unsat_cl_id(cl.id);
             solver->ok = false;
             return false;
         }
@@ -475,7 +475,7 @@ bool OccSimplifier::complete_clean_clause(Clause& cl)
             return false;
         }
         case 2:
-            solver->attach_bin_clause(cl[0], cl[1], cl.red(), cl.stats.id);
+            solver->attach_bin_clause(cl[0], cl[1], cl.red(), cl.id);
             return false;
 
         default:
@@ -576,7 +576,7 @@ OccSimplifier::LinkInData OccSimplifier::link_in_clauses(
         Clause* cl = solver->cl_alloc.ptr(offs);
         cl->recalc_abst_if_needed();
         assert(cl->abst == calcAbstraction(*cl));
-        assert(!cl->red() || cl->stats.glue > 0);
+        assert(!cl->red() || solver->cl_alloc.red_stats(cl).glue > 0);
 
         if (alsoOccur
             && cl->size() < max_size
@@ -638,7 +638,7 @@ void OccSimplifier::check_cls_sanity() {
     for (const ClOffset offs: clauses) {
         Clause* cl = solver->cl_alloc.ptr(offs);
         if (cl->get_removed() || cl->freed()) continue;
-        assert(!cl->stats.marked_clause);
+        assert(!cl->marked_clause);
         if (cl->size() <= 2) cout << "ERROR: too short cl: " << *cl << endl;
         assert(cl->size() > 2);
     }
@@ -653,7 +653,7 @@ void OccSimplifier::add_back_to_solver() {
     for (const ClOffset offs: clauses) {
         Clause* cl = solver->cl_alloc.ptr(offs);
         if (cl->get_removed() || cl->freed()) continue;
-        assert(!cl->stats.marked_clause);
+        assert(!cl->marked_clause);
         assert(cl->size() > 2);
 
         if (check_varelim_when_adding_back_cl(cl)) {
@@ -671,9 +671,10 @@ void OccSimplifier::add_back_to_solver() {
         } else if (complete_clean_clause(*cl)) {
             solver->attachClause(*cl);
             if (cl->red()) {
-                assert(cl->stats.glue > 0);
-                assert(cl->stats.which_red_array < solver->longRedCls.size());
-                solver->longRedCls[cl->stats.which_red_array].push_back(offs);
+                const RedClauseStats& red_stats = solver->cl_alloc.red_stats(cl);
+                assert(red_stats.glue > 0);
+                assert(red_stats.which_red_array < solver->longRedCls.size());
+                solver->longRedCls[red_stats.which_red_array].push_back(offs);
             } else {
                 solver->longIrredCls.push_back(offs);
             }
@@ -1059,8 +1060,8 @@ bool OccSimplifier::mark_and_push_to_added_long_cl_cls_containing(const Lit lit)
             Clause* cl = solver->cl_alloc.ptr(offs);
 
             //Has already been removed or added to "added_long_cl"
-            if (cl->freed() || cl->get_removed() || cl->stats.marked_clause) continue;
-            cl->stats.marked_clause = 1;
+            if (cl->freed() || cl->get_removed() || cl->marked_clause) continue;
+            cl->marked_clause = 1;
             added_long_cl.push_back(offs);
         }
     }
@@ -1105,7 +1106,7 @@ void OccSimplifier::check_no_marked_clauses()
     for(const auto& off: clauses) {
         Clause* cl = solver->cl_alloc.ptr(off);
         if (!cl->get_removed()) {
-            assert(!cl->stats.marked_clause);
+            assert(!cl->marked_clause);
         }
     }
 }
@@ -1176,7 +1177,7 @@ void OccSimplifier::subs_with_resolvent_clauses()
             else if (pos.isClause()) {
                 const Clause *cl = solver->cl_alloc.ptr(pos.get_offset());
                 if (cl->get_removed() || cl->red()) continue;
-                id1 = cl->stats.id;
+                id1 = cl->id;
             } else { assert(false); }
 
             for (auto const& neg: tmp_negs) {
@@ -1188,7 +1189,7 @@ void OccSimplifier::subs_with_resolvent_clauses()
                 } else if (neg.isClause()) {
                     const Clause *cl = solver->cl_alloc.ptr(neg.get_offset());
                     if (cl->get_removed() || cl->red()) continue;
-                    id2 = cl->stats.id;
+                    id2 = cl->id;
                 } else { assert(false); }
 
                 //Resolve the two clauses
@@ -1222,7 +1223,7 @@ void OccSimplifier::subs_with_resolvent_clauses()
                         removed++;
                     } else if (sub.ws.isClause()) {
                         const Clause* cl = solver->cl_alloc.ptr(sub.ws.get_offset());
-                        const auto id3 = cl->stats.id;
+                        const auto id3 = cl->id;
                         if (id3 == id1 || id3 == id2 || cl->red()) continue;
                         unlink_clause(sub.ws.get_offset(), true, false, true);
                         removed++;
@@ -1310,7 +1311,7 @@ bool OccSimplifier::eliminate_vars()
         limit_to_decrease = &norm_varelim_time_limit;
         order_vars_for_elim();
         if (velim_order.size() < 400) {
-            for(auto& v: solver->varData) v.occ_simp_tried = 0;
+            for(auto v: solver->varData) v.occ_simp_tried = 0;
         }
 
         added_cl_to_var.clear();
@@ -1998,7 +1999,9 @@ vector<ITEGate> OccSimplifier::recover_ite_gates()
         out_a_all.clear();
         gates_poss.clear(); //temps, not needed
         gates_negs.clear(); //temps, not needed
-        find_ite_gate(lit, solver->watches[lit], solver->watches[~lit],
+        solver->watches[lit].copyTo(poss);
+        solver->watches[~lit].copyTo(negs);
+        find_ite_gate(lit, poss, negs,
                       gates_poss, gates_negs, //temporaries, actually not used
                       &out_a_all); // what we are looking for
 
@@ -2095,7 +2098,7 @@ bool OccSimplifier::cl_rem_with_or_gates()
             Clause* cl1 = solver->cl_alloc.ptr(w.get_offset());
             if (cl1->get_removed() || cl1->red()) continue;
             if (cl1->size() <= 3) continue; // we could mess with definition of gates
-            if (cl1->stats.id == g.id) continue;
+            if (cl1->id == g.id) continue;
 
             bool found = false;
             for(auto const&l: *cl1) {
@@ -2110,7 +2113,7 @@ bool OccSimplifier::cl_rem_with_or_gates()
                 Clause* cl2 = solver->cl_alloc.ptr(w2.get_offset());
                 if (cl1->get_removed()) continue; // COULD HAVE BEEN REMOVED BELOW
                 if (cl2->get_removed() || cl2->red()) continue;
-                if (cl2->stats.id == g.id) continue;
+                if (cl2->id == g.id) continue;
                 if (cl2->size() != cl1->size()) continue;
                 auto myabst1 = cl1->abst | abst_var(g.lits[1].var());
                 auto myabst2 = cl2->abst | abst_var(g.lits[0].var());
@@ -2130,7 +2133,8 @@ bool OccSimplifier::cl_rem_with_or_gates()
                         dummy.push_back(l);
                     }
 
-                    auto s = ClauseStats::combineStats(cl1->stats, cl2->stats);
+                    auto s = ClauseStats::combineStats(
+                        solver->cl_alloc.get_stats(cl1), solver->cl_alloc.get_stats(cl2));
                     full_add_clause(dummy, weaken_dummy, &s, false);
                     unlink_clause(w.get_offset(), true, false, true);
                     unlink_clause(w2.get_offset(), true, false, true);
@@ -2320,7 +2324,7 @@ bool OccSimplifier::lit_rem_with_or_gates() {
             assert(w.isClause());
             const auto off = w.get_offset();
             Clause* cl = solver->cl_alloc.ptr(w.get_offset());
-            if (cl->stats.id == gate.id || //the gate definition, skip
+            if (cl->id == gate.id || //the gate definition, skip
                 cl->red() || //no need, slow
                 cl->get_removed())
             {
@@ -2441,7 +2445,7 @@ bool OccSimplifier::execute_simplifier_strategy(const string& strategy)
             if (!cl->red()) {
                 continue;
             }
-            assert(solver->red_stats_extra[cl->stats.extra_pos].introduced_at_conflict != 0);
+            assert(solver->red_stats_extra[solver->cl_alloc.red_stats(cl).extra_pos].introduced_at_conflict != 0);
         }
         #endif
         solver->check_implicit_propagated();
@@ -2766,13 +2770,14 @@ bool OccSimplifier::perform_ternary(Clause* cl, ClOffset offs, Sub1Ret& sub1_ret
         Clause* newCl = full_add_clause(tmp_tern_res, finalLits_ternary, &stats, true);
         if (newCl) {
             #ifdef STATS_NEEDED
-            newCl->stats.locked_for_data_gen =
+            RedClauseStats& red_stats = solver->cl_alloc.red_stats(newCl);
+            red_stats.locked_for_data_gen =
                 (double)rnd_uint(solver->mtrand,100000)/100000.0  < solver->conf.lock_for_data_gen_ratio;
-            if (newCl->stats.locked_for_data_gen) newCl->stats.which_red_array = 0;
+            if (red_stats.locked_for_data_gen) red_stats.which_red_array = 0;
             #endif
             #if defined(STATS_NEEDED) || defined(FINAL_PREDICTOR)
             solver->red_stats_extra.push_back(stats_extra);
-            newCl->stats.extra_pos = solver->red_stats_extra.size()-1;
+            solver->cl_alloc.red_stats(newCl).extra_pos = solver->red_stats_extra.size()-1;
             #endif
             ClOffset off = solver->cl_alloc.get_offset(newCl);
             if (!sub_str->backw_sub_str_with_long(off, sub1_ret)) {
@@ -2870,7 +2875,7 @@ void OccSimplifier::check_ternary_cl(Clause* cl, ClOffset offs, watch_subarray w
     }
 }
 
-void OccSimplifier::fill_tocheck_seen(const vec<Watched>& ws, vector<uint32_t>& tocheck)
+void OccSimplifier::fill_tocheck_seen(watch_subarray_const ws, vector<uint32_t>& tocheck)
 {
     for(const auto& w: ws) {
         assert(!w.isBNN());
@@ -3459,7 +3464,7 @@ void OccSimplifier::rem_cls_from_watch_due_to_varelim(const Lit lit, bool only_s
 
                 lits.resize(cl.size());
                 std::copy(cl.begin(), cl.end(), lits.begin());
-                add_clause_to_blck(lits, cl.stats.id);
+                add_clause_to_blck(lits, cl.id);
             } else {
                 red = true;
             }
@@ -3556,8 +3561,8 @@ void OccSimplifier::add_picosat_cls(
 
 bool OccSimplifier::find_irreg_gate(
     Lit elim_lit
-    , watch_subarray_const a
-    , watch_subarray_const b
+    , const vec<Watched>& a
+    , const vec<Watched>& b
     , vec<Watched>& out_a
     , vec<Watched>& out_b
 ) {
@@ -3612,8 +3617,8 @@ bool OccSimplifier::find_irreg_gate(
 
 bool OccSimplifier::find_or_gate(
     Lit elim_lit
-    , watch_subarray_const a
-    , watch_subarray_const b
+    , const vec<Watched>& a
+    , const vec<Watched>& b
     , vec<Watched>& out_a
     , vec<Watched>& out_b
 ) {
@@ -3675,8 +3680,8 @@ bool OccSimplifier::find_or_gate(
 
 bool OccSimplifier::find_ite_gate(
     Lit elim_lit
-    , watch_subarray_const a
-    , watch_subarray_const b
+    , const vec<Watched>& a
+    , const vec<Watched>& b
     , vec<Watched>& out_a
     , vec<Watched>& out_b
     , vec<Watched>* out_a_all
@@ -3897,8 +3902,8 @@ bool OccSimplifier::find_ite_gate(
 
 bool OccSimplifier::find_equivalence_gate(
     [[maybe_unused]] Lit elim_lit
-    , watch_subarray_const a
-    , watch_subarray_const b
+    , const vec<Watched>& a
+    , const vec<Watched>& b
     , vec<Watched>& out_a
     , vec<Watched>& out_b
 ) {
@@ -3937,8 +3942,8 @@ bool OccSimplifier::find_equivalence_gate(
 
 bool OccSimplifier::find_xor_gate(
     [[maybe_unused]] Lit elim_lit
-    , watch_subarray_const a
-    , watch_subarray_const b
+    , const vec<Watched>& a
+    , const vec<Watched>& b
     , vec<Watched>& out_a
     , vec<Watched>& out_b
 ) {
@@ -3967,7 +3972,7 @@ bool OccSimplifier::find_xor_gate(
 
         assert(w.isClause());
         Clause* cl = solver->cl_alloc.ptr(w.get_offset());
-        if (cl->size() > maxsize || cl->stats.marked_clause || cl->red()) {
+        if (cl->size() > maxsize || cl->marked_clause || cl->red()) {
             continue;
         }
         size = cl->size();
@@ -3987,7 +3992,7 @@ bool OccSimplifier::find_xor_gate(
         }
         out_a.clear();
         out_a.push(w);
-        cl->stats.marked_clause = 1;
+        cl->marked_clause = 1;
         toclear_marked_cls.push_back(cl);
         std::sort(cl->begin(), cl->end());
         uint32_t val = 0;
@@ -4006,7 +4011,7 @@ bool OccSimplifier::find_xor_gate(
             assert(w2.isClause());
             Clause* cl2 = solver->cl_alloc.ptr(w2.get_offset());
             SLOW_DEBUG_DO(assert(!cl2->red()));
-            if (cl2->size() != size || cl2->stats.marked_clause) continue;
+            if (cl2->size() != size || cl2->marked_clause) continue;
 
             bool this_cl_ok = true;
             bool myparity = 0;
@@ -4020,7 +4025,7 @@ bool OccSimplifier::find_xor_gate(
 
             //cout << "Mypar: " << myparity << " real par: " << parity << " ok: " << this_cl_ok << endl;
             if (this_cl_ok && myparity == parity) {
-                cl2->stats.marked_clause = 1;
+                cl2->marked_clause = 1;
                 toclear_marked_cls.push_back(cl2);
                 std::sort(cl2->begin(), cl2->end());
                 val = 0;
@@ -4051,7 +4056,7 @@ bool OccSimplifier::find_xor_gate(
             assert(w2.isClause());
             Clause* cl2 = solver->cl_alloc.ptr(w2.get_offset());
             SLOW_DEBUG_DO(assert(!cl2->red()));
-            if (cl2->size() != size || cl2->stats.marked_clause) {
+            if (cl2->size() != size || cl2->marked_clause) {
                 continue;
             }
             bool this_cl_ok = true;
@@ -4065,7 +4070,7 @@ bool OccSimplifier::find_xor_gate(
             }
             //cout << "Mypar: " << myparity << " real par: " << parity << " ok: " << this_cl_ok << endl;
             if (this_cl_ok && myparity == parity) {
-                cl2->stats.marked_clause = 1;
+                cl2->marked_clause = 1;
                 toclear_marked_cls.push_back(cl2);
                 std::sort(cl2->begin(), cl2->end());
                 val = 0;
@@ -4109,7 +4114,7 @@ bool OccSimplifier::find_xor_gate(
 
     //Cleark cl markings
     for(const auto& cl: toclear_marked_cls) {
-        cl->stats.marked_clause = 0;
+        cl->marked_clause = 0;
     }
     toclear_marked_cls.clear();
     parities_found.clear();
@@ -4339,15 +4344,16 @@ bool OccSimplifier::generate_resolvents(
             ClauseStats stats;
             if (it->isBin() && it2->isClause()) {
                 Clause* c = solver->cl_alloc.ptr(it2->get_offset());
-                stats = c->stats;
+                stats = solver->cl_alloc.get_stats(c);
             } else if (it2->isBin() && it->isClause()) {
                 Clause* c = solver->cl_alloc.ptr(it->get_offset());
-                stats = c->stats;
+                stats = solver->cl_alloc.get_stats(c);
             } else if (it2->isClause() && it->isClause()) {
                 Clause* c1 = solver->cl_alloc.ptr(it->get_offset());
                 Clause* c2 = solver->cl_alloc.ptr(it2->get_offset());
                 //Neither are redundant, this works.
-                stats = ClauseStats::combineStats(c1->stats, c2->stats);
+                stats = ClauseStats::combineStats(
+                    solver->cl_alloc.get_stats(c1), solver->cl_alloc.get_stats(c2));
             }
             //must clear marking that has been set due to gate
             //strengthen_dummy_with_bins(false);
@@ -4381,7 +4387,7 @@ void OccSimplifier::get_antecedents(
 }
 
 void OccSimplifier::clean_from_red_or_removed(
-    const vec<Watched>& in,
+    watch_subarray_const in,
     vec<Watched>& out)
 {
     out.clear();
@@ -5429,7 +5435,7 @@ size_t OccSimplifier::mem_used() const
 
 void OccSimplifier::link_in_clause(Clause& cl)
 {
-    assert(!cl.stats.marked_clause);
+    assert(!cl.marked_clause);
     assert(cl.size() > 2);
     ClOffset offset = solver->cl_alloc.get_offset(&cl);
     cl.recalc_abst_if_needed();
@@ -5439,7 +5445,7 @@ void OccSimplifier::link_in_clause(Clause& cl)
             added_cl_to_var.touch(l.var());
         }
     }
-    assert(cl.stats.marked_clause == 0 && "marks must always be zero at linkin");
+    assert(cl.marked_clause == 0 && "marks must always be zero at linkin");
 
     std::sort(cl.begin(), cl.end());
     for (const Lit lit: cl) {
@@ -150,7 +150,7 @@ public:
     bool get_elimed_clause_at(uint32_t& at,uint32_t& at2, vector<Lit>& out, bool& is_xor) const;
     vector<vector<Lit>> get_elimed_clauses_for(uint32_t outer_v);
     void subs_with_resolvent_clauses();
-    void fill_tocheck_seen(const vec<Watched>& ws, vector<uint32_t>& tocheck);
+    void fill_tocheck_seen(watch_subarray_const ws, vector<uint32_t>& tocheck);
     void delete_component_unconnected_to_assumps(); //for arjun
     void strengthen_dummy_with_bins(const bool avoid_redundant);
     void reverse_blocked_clause_elim();
@@ -425,7 +425,7 @@ private:
     vec<Watched> negs;
     void clean_from_satisfied(vec<Watched>& in);
     void clean_from_red_or_removed(
-        const vec<Watched>& in,
+        watch_subarray_const in,
         vec<Watched>& out);
     void  create_dummy_elimed_clause(Lit lit, bool is_xor = false);
     vector<OccurClause> tmp_subs;
@@ -433,8 +433,8 @@ private:
     void        get_gate(Lit elim_lit, watch_subarray_const poss, watch_subarray_const negs);
     bool find_or_gate(
         Lit lit,
-        watch_subarray_const a,
-        watch_subarray_const b,
+        const vec<Watched>& a,
+        const vec<Watched>& b,
         vec<Watched>& out_a,
         vec<Watched>& out_b
     );
@@ -443,26 +443,26 @@ private:
     bool resolve_gate;
     bool find_irreg_gate(
         Lit elim_lit,
-        watch_subarray_const a,
-        watch_subarray_const b,
+        const vec<Watched>& a,
+        const vec<Watched>& b,
         vec<Watched>& out_a,
         vec<Watched>& out_b);
     bool find_equivalence_gate(
         Lit lit
-        , watch_subarray_const a
-        , watch_subarray_const b
+        , const vec<Watched>& a
+        , const vec<Watched>& b
         , vec<Watched>& out_a
         , vec<Watched>& out_b);
     bool find_xor_gate(
         Lit lit
-        , watch_subarray_const a
-        , watch_subarray_const b
+        , const vec<Watched>& a
+        , const vec<Watched>& b
         , vec<Watched>& out_a
         , vec<Watched>& out_b);
     bool find_ite_gate(
         Lit elim_lit
-        , watch_subarray_const a
-        , watch_subarray_const b
+        , const vec<Watched>& a
+        , const vec<Watched>& b
         , vec<Watched>& out_a
         , vec<Watched>& out_b
         , vec<Watched>* out_a_all = nullptr
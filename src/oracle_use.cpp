@@ -518,8 +518,8 @@ bool Solver::oracle_sparsify(bool fast)
             removed++;
             if (!c.binary) {
                 Clause& cl = *cl_alloc.ptr(c.off);
-                assert(!cl.stats.marked_clause);
-                cl.stats.marked_clause = 1;
+                assert(!cl.marked_clause);
+                cl.marked_clause = 1;
             } else {
                 removed_bin++;
                 Lit lit1 = c.bin.l1;
@@ -560,7 +560,7 @@ bool Solver::oracle_sparsify(bool fast)
                 continue;
             } else if (ws[i].isClause()) {
                 Clause* cl = cl_alloc.ptr(ws[i].get_offset());
-                if (conf.oracle_removed_is_learnt || !cl->stats.marked_clause) ws[j++] = ws[i];
+                if (conf.oracle_removed_is_learnt || !cl->marked_clause) ws[j++] = ws[i];
                 continue;
             }
         }
@@ -573,16 +573,16 @@ bool Solver::oracle_sparsify(bool fast)
     for(uint32_t i = 0; i < longIrredCls.size(); i++) {
         ClOffset off = longIrredCls[i];
         Clause* cl = cl_alloc.ptr(off);
-        if (!cl->stats.marked_clause) {
+        if (!cl->marked_clause) {
             longIrredCls[j++] = longIrredCls[i];
         } else {
             litStats.irredLits -= cl->size();
             if (conf.oracle_removed_is_learnt) {
-                cl->stats.marked_clause = false;
+                cl->marked_clause = false;
                 litStats.redLits += cl->size();
                 longRedCls[2].push_back(off);
-                cl->stats.which_red_array = 2;
-                cl->isRed = true;
+                cl_alloc.make_red(cl);
+                cl_alloc.red_stats(cl).which_red_array = 2;
             } else {
                 cl_alloc.clauseFree(off);
             }
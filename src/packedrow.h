@@ -36,6 +36,7 @@ THE SOFTWARE.
 #include "solvertypes.h"
 #include "Vec.h"
 #include "xor.h"
+#include "rowkernels.h"
 
 namespace CMSat {
 
@@ -73,6 +74,10 @@ public:
         #endif
 
         //start from -1, because that's wher RHS is
+        if ((uint32_t)size + 1 >= row_simd_min_words) {
+            row_kernels.xor_into(mp - 1, b.mp - 1, size + 1);
+            return *this;
+        }
         for (int i = -1; i < size; i++) {
             *(mp + i) ^= *(b.mp + i);
         }
@@ -88,6 +93,10 @@ public:
         assert(b.size == size);
         #endif
 
+        if ((uint32_t)size >= row_simd_min_words) {
+            row_kernels.and_inv(mp, b.mp, size);
+            return;
+        }
         for (int i = 0; i < size; i++) {
             *(mp + i) &= ~(*(b.mp + i));
         }
@@ -101,6 +110,10 @@ public:
         assert(b.size == size);
         #endif
 
+        if ((uint32_t)size >= row_simd_min_words) {
+            row_kernels.set_and_inv(mp, a.mp, b.mp, size);
+            return;
+        }
         for (int i = 0; i < size; i++) {
             *(mp + i) = *(a.mp + i) & (~(*(b.mp + i)));
         }
@@ -114,6 +127,10 @@ public:
         assert(b.size == size);
         #endif
 
+        if ((uint32_t)size >= row_simd_min_words) {
+            row_kernels.set_and(mp, a.mp, b.mp, size);
+            return;
+        }
         for (int i = 0; i < size; i++) {
             *(mp + i) = *(a.mp + i) & *(b.mp + i);
         }
@@ -127,6 +144,10 @@ public:
         assert(b.size == size);
         #endif
 
+        if ((uint32_t)size >= row_simd_min_words) {
+            return row_kernels.set_and_popcnt_atleast2(mp, a.mp, b.mp, size);
+        }
+
         uint32_t pop = 0;
         for (int i = 0; i < size && pop < 2; i++) {
             *(mp + i) = *(a.mp + i) & *(b.mp + i);
@@ -145,11 +166,54 @@ public:
         #endif
 
         rhs_internal ^= b.rhs_internal;
+        if ((uint32_t)size >= row_simd_min_words) {
+            row_kernels.xor_into(mp, b.mp, size);
+            return;
+        }
         for (int i = 0; i < size; i++) {
             *(mp + i) ^= *(b.mp + i);
         }
     }
 
+    //As xor_in(), for a 'b' that's zero before word 'from'
+    void xor_in_from(const PackedRow& b, const uint32_t from)
+    {
+        #ifdef DEBUG_ROW
+        assert(b.size == size);
+        assert((int)from <= size);
+        #endif
+
+        rhs_internal ^= b.rhs_internal;
+        const uint32_t n = size - from;
+        if (n >= row_simd_min_words) {
+            row_kernels.xor_into(mp + from, b.mp + from, n);
+            return;
+        }
+        for (int i = from; i < size; i++) {
+            *(mp + i) ^= *(b.mp + i);
+        }
+    }
+
+    //Sets the rhs, and the words from 'from' on, to those of a^b
+    void set_xor_from(const PackedRow& a, const PackedRow& b, const uint32_t from)
+    {
+        #ifdef DEBUG_ROW
+        assert(a.size == size);
+        assert(b.size == size);
+        assert((int)from <= size);
+        #endif
+
+        rhs_internal = a.rhs_internal ^ b.rhs_internal;
+        const uint32_t n = size - from;
+        if (n >= row_simd_min_words) {
+            row_kernels.set_xor(mp + from, a.mp + from, b.mp + from, n);
+            return;
+        }
+        for (int i = from; i < size; i++) {
+            *(mp + i) = *(a.mp + i) ^ *(b.mp + i);
+        }
+    }
+
     inline const int64_t& rhs() const
     {
         return rhs_internal;
@@ -318,6 +382,10 @@ inline uint32_t PackedRow::popcnt_at_least_2() const
 
 inline uint32_t PackedRow::popcnt() const
 {
+    if ((uint32_t)size >= row_simd_min_words) {
+        return row_kernels.popcnt(mp, size);
+    }
+
     uint32_t ret = 0;
     for (int i = 0; i < size; i++) {
         ret += __builtin_popcountll((uint64_t)mp[i]);
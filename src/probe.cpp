@@ -23,6 +23,7 @@ THE SOFTWARE.
 #include "constants.h"
 #include "solver.h"
 #include <random>
+#include <algorithm>
 #include "varreplacer.h"
 
 using namespace CMSat;
@@ -238,3 +239,85 @@ lbool Solver::probe_outside(Lit l, uint32_t& min_props)
     if (!okay()) return l_False;
     return l_Undef;
 }
+
+/**
+@brief Lookahead for cube-and-conquer: the literal to split 'cube' on
+
+The cube, in OUTER numbering, is propagated, then both polarities of the most
+active free variables are propagated on top of it. The variable whose two
+sides together set the most variables is picked, as in march. A side that
+fails counts as setting everything, the cube with it is refuted at once.
+
+Returns lit_Error if the cube itself fails, and lit_Undef if there is nothing
+left to split on.
+*/
+Lit Solver::cube_split_lit(const vector<Lit>& cube)
+{
+    assert(decisionLevel() == 0);
+    if (!okay()) return lit_Error;
+    assert(prop_at_head());
+
+    new_decision_level();
+    for(Lit l: cube) {
+        assert(l.var() < nVarsOuter());
+        l = varReplacer->get_lit_replaced_with_outer(l);
+        l = map_outer_to_inter(l);
+        if (varData[l.var()].removed != Removed::none) continue;
+        if (value(l) == l_False) {
+            cancelUntil_light();
+            return lit_Error;
+        }
+        if (value(l) == l_Undef) enqueue_light(l);
+    }
+    if (!propagate_light<false>().isnullptr()) {
+        cancelUntil_light();
+        return lit_Error;
+    }
+
+    //The most active ones, the ones in the most watchlists if none is active
+    vector<uint32_t> cands;
+    for(uint32_t v = 0; v < nVars(); v++) {
+        if (value(v) == l_Undef && varData[v].removed == Removed::none) cands.push_back(v);
+    }
+    const auto more_active = [&](const uint32_t a, const uint32_t b) {
+        if (var_act_vsids[a] != var_act_vsids[b]) return var_act_vsids[a] > var_act_vsids[b];
+        if (vmtf_btab[a] != vmtf_btab[b]) return vmtf_btab[a] > vmtf_btab[b];
+        return watches[Lit(a, false)].size() + watches[Lit(a, true)].size()
+            > watches[Lit(b, false)].size() + watches[Lit(b, true)].size();
+    };
+    const size_t num_cands = std::min<size_t>(cands.size(), std::max(conf.cube_cands, 1U));
+    std::partial_sort(cands.begin(), cands.begin() + num_cands, cands.end(), more_active);
+    cands.resize(num_cands);
+
+    //Number of variables set by 'l' on top of the cube, or 'failed' if it fails
+    const uint64_t failed = nVars();
+    const auto lookahead = [&](const Lit l) -> uint64_t {
+        const uint32_t old_trail_size = trail.size();
+        enqueue_light(l);
+        const bool fail = !propagate_light<false>().isnullptr();
+        const uint64_t num = trail.size() - old_trail_size;
+        for(uint32_t i = old_trail_size; i < trail.size(); i++) {
+            set_var_value(trail[i].lit.var(), l_Undef);
+        }
+        trail.resize(old_trail_size);
+        qhead = old_trail_size;
+        return fail ? failed : num;
+    };
+
+    Lit best = lit_Undef;
+    uint64_t best_score = 0;
+    for(const uint32_t v: cands) {
+        const uint64_t pos = lookahead(Lit(v, false));
+        const uint64_t neg = lookahead(Lit(v, true));
+        const uint64_t score = (pos+1)*(neg+1);
+        if (best == lit_Undef || score > best_score) {
+            best_score = score;
+            //The side setting more first, it's the one more likely to fail
+            best = Lit(v, neg > pos);
+        }
+    }
+    cancelUntil_light();
+
+    if (best == lit_Undef) return lit_Undef;
+    return map_inter_to_outer(best);
+}
@@ -60,6 +60,7 @@ PropEngine::PropEngine(
         , qhead(0)
         , solver(_solver)
 {
+    find_non_false = get_find_non_false(conf.prop_simd);
 }
 
 PropEngine::~PropEngine()
@@ -605,6 +606,7 @@ bool PropEngine::prop_long_cl_any_order(
         return true;
     }
     if (inprocess) propStats.bogoProps += 4;
+    propStats.clVisited++;
     const ClOffset offset = i->get_offset();
     Clause& c = *cl_alloc.ptr(offset);
 
@@ -626,6 +628,10 @@ bool PropEngine::prop_long_cl_any_order(
         return true;
     }
 
+    if (ClauseAllocator::is_shared(offset)) {
+        return prop_shared_cl<inprocess>(i, j, p, confl, currLevel, c, offset);
+    }
+
     if (prop_normal_helper<inprocess>(c, offset, j, p) == PROP_NOTHING)
         return true;
 
@@ -637,8 +643,10 @@ bool PropEngine::prop_long_cl_any_order(
     } else {
         if (!inprocess) {
             #if defined(STATS_NEEDED) || defined(FINAL_PREDICTOR)
-            c.stats.props_made++;
-            c.stats.last_touched_any = sumConflicts;
+            if (c.red()) {
+                cl_alloc.red_stats(&c).props_made++;
+                cl_alloc.red_stats(&c).last_touched_any = sumConflicts;
+            }
             #endif
         }
 
@@ -669,6 +677,146 @@ bool PropEngine::prop_long_cl_any_order(
     return true;
 }
 
+/**
+@brief Propagates a clause of the shared region
+
+Same as prop_normal_helper() and the rest of prop_long_cl_any_order(), but
+the literals stay where they are, only the positions of the watched ones in
+shared_watch change.
+*/
+template<bool inprocess>
+bool PropEngine::prop_shared_cl(
+    Watched* i
+    , Watched*& j
+    , const Lit p
+    , PropBy& confl
+    , uint32_t currLevel
+    , const Clause& c
+    , const ClOffset offset
+) {
+    SharedWatch& w = shared_watch[c.shared_at];
+    if (c[w.w0] == ~p) {
+        std::swap(w.w0, w.w1);
+    }
+    assert(c[w.w1] == ~p);
+
+    const Lit first = c[w.w0];
+    if (value(first) == l_True) {
+        *j++ = Watched(offset, first);
+        return true;
+    }
+
+    //Look for new watch
+    for (uint32_t k = 0; k < c.size(); k++) {
+        if (k == w.w0 || k == w.w1) continue;
+        if (value(c[k]) != l_False) {
+            w.w1 = k;
+            watches[c[k]].push(Watched(offset, first));
+            return true;
+        }
+    }
+
+    // Did not find watch -- clause is unit under assignment:
+    *j++ = *i;
+    if (value(first) == l_False) {
+        confl = PropBy(offset);
+        qhead = trail.size();
+        return false;
+    }
+
+    uint32_t nMaxLevel = currLevel;
+    if (currLevel != decisionLevel()) {
+        uint32_t nMaxInd = w.w1;
+        for (uint32_t k = 0; k < c.size(); k++) {
+            if (k == w.w0 || k == w.w1) continue;
+            const uint32_t nLevel = varData[c[k].var()].level;
+            if (nLevel > nMaxLevel) {
+                nMaxLevel = nLevel;
+                nMaxInd = k;
+            }
+        }
+
+        if (nMaxInd != w.w1) {
+            w.w1 = nMaxInd;
+            j--; // undo last watch
+            watches[c[w.w1]].push(*i);
+        }
+    }
+    enqueue<inprocess>(first, nMaxLevel, PropBy(offset));
+
+    return true;
+}
+
+Lit* PropEngine::shared_reason_lits(const Clause& c)
+{
+    const SharedWatch& w = shared_watch[c.shared_at];
+    shared_reason_tmp.clear();
+    shared_reason_tmp.push_back(c[w.w0]);
+    shared_reason_tmp.push_back(c[w.w1]);
+    for (uint32_t k = 0; k < c.size(); k++) {
+        if (k == w.w0 || k == w.w1) continue;
+        shared_reason_tmp.push_back(c[k]);
+    }
+    return shared_reason_tmp.data();
+}
+
+/**
+@brief Makes 'lit' the first watched literal of a shared clause
+
+This is what swapping 'lit' to c[0] does for other clauses. If 'lit' was not
+watched, the first watched literal stops being watched.
+*/
+void PropEngine::set_shared_first_watch(const ClOffset offset, const Lit lit)
+{
+    const Clause& c = *cl_alloc.ptr(offset);
+    SharedWatch& w = shared_watch[c.shared_at];
+    if (c[w.w0] == lit) return;
+    if (c[w.w1] == lit) {
+        std::swap(w.w0, w.w1);
+        return;
+    }
+
+    uint32_t k = 0;
+    while (c[k] != lit) k++;
+    removeWCl(watches[c[w.w0]], offset);
+    w.w0 = k;
+    watches[c[w.w0]].push(Watched(offset, c[w.w1]));
+}
+
+/**
+@brief Attaches a clause of the shared region, at decision level 0
+
+Literals false at level 0 are only watched if there is nothing else to
+watch. If only one literal is not false, it's enqueued. Returns false if all
+literals are false.
+*/
+bool PropEngine::attach_shared_clause(const ClOffset offset)
+{
+    assert(decisionLevel() == 0);
+    const Clause& c = *cl_alloc.ptr(offset);
+    assert(c.shared_at == shared_watch.size());
+
+    uint32_t at[2];
+    uint32_t num = 0;
+    for (uint32_t k = 0; k < c.size() && num < 2; k++) {
+        if (value(c[k]) != l_False) at[num++] = k;
+    }
+    if (num == 0) {
+        return false;
+    }
+    if (num == 1) {
+        if (value(c[at[0]]) == l_Undef) {
+            enqueue<false>(c[at[0]]);
+        }
+        at[1] = (at[0] == 0) ? 1 : 0;
+    }
+
+    shared_watch.push_back(SharedWatch{at[0], at[1]});
+    watches[c[at[0]]].push(Watched(offset, c[at[1]]));
+    watches[c[at[1]]].push(Watched(offset, c[at[0]]));
+    return true;
+}
+
 void CMSat::PropEngine::reverse_one_bnn(uint32_t idx, BNNPropType t) {
     BNN* const bnn= bnns[idx];
     SLOW_DEBUG_DO(assert(bnn != nullptr));
@@ -712,6 +860,8 @@ PropBy PropEngine::propagate_any_order()
 {
     PropBy confl;
     VERBOSE_PRINT("propagate_any_order started");
+    const uint32_t lookahead = conf.prop_prefetch_lookahead;
+    find_non_false = get_find_non_false(conf.prop_simd);
 
     while (qhead < trail.size() && confl.isnullptr()) {
         const Lit p = trail[qhead].lit;     // 'p' is enqueued fact to propagate.
@@ -720,39 +870,71 @@ PropBy PropEngine::propagate_any_order()
         uint32_t currLevel = trail[qhead].lev;
 
         Watched* i = ws.begin();
-        Watched* j = i;
         Watched* end = ws.end();
         if (inprocess) {
             propStats.bogoProps += ws.size()/4 + 1;
         }
         propStats.propagations++;
         simpDB_props--;
-        for (; i != end; i++) {
-            // propagate binary clause
-            if (likely(i->isBin())) {
-                *j++ = *i;
-                if (!red_also && i->red()) continue;
-                if (distill_use && i->bin_cl_marked()) continue;
-                prop_bin_cl<inprocess>(i, p, confl, currLevel);
-                continue;
-            }
 
-            // propagate BNN constraint
-            if (i->isBNN()) {
-                *j++ = *i;
-                const lbool val = bnn_prop(i->get_bnn(), currLevel, p, i->get_bnn_prop_t());
-                if (val == l_False) confl = PropBy(i->get_bnn(), nullptr);
-                continue;
-            }
-
-            //propagate normal clause
-            assert(i->isClause());
-            prop_long_cl_any_order<inprocess, red_also, distill_use>(i, j, p, confl, currLevel);
+        // Binary clauses are kept at the front of the watchlist by
+        // consolidate_watches(). Go through them in a tight loop first,
+        // nothing is removed from here, so no need to copy them back.
+        for (; i != end && i->isBin(); i++) {
+            if (!red_also && i->red()) continue;
+            if (distill_use && i->bin_cl_marked()) continue;
+            if (!prop_bin_cl<inprocess>(i, p, confl, currLevel)) break;
         }
-        while (i != end) {
-            *j++ = *i++;
+
+        // Binary conflict -- the rest of the watchlist stays as-is
+        if (confl.isnullptr()) {
+            Watched* j = i;
+
+            // Prefetch the clauses of the next 'lookahead' long watches whose
+            // blocked literal is not satisfied. Values only go from l_Undef
+            // to set here, so a watch that is not satisfied when 'i' reaches
+            // it was not satisfied when 'pf' went past it either. The other
+            // way around is possible, so restart the count once 'i' catches up.
+            Watched* pf = i;
+            uint32_t in_flight = 0;
+            for (; i != end; i++) {
+                if (pf == i) in_flight = 0;
+                while (in_flight < lookahead && pf != end) {
+                    if (pf->isClause() && value(pf->getBlockedLit()) != l_True) {
+                        cmsat_prefetch(cl_alloc.ptr(pf->get_offset()));
+                        propStats.clPrefetched++;
+                        in_flight++;
+                    }
+                    pf++;
+                }
+
+                // propagate binary clause added since last consolidation
+                if (i->isBin()) {
+                    *j++ = *i;
+                    if (!red_also && i->red()) continue;
+                    if (distill_use && i->bin_cl_marked()) continue;
+                    prop_bin_cl<inprocess>(i, p, confl, currLevel);
+                    continue;
+                }
+
+                // propagate BNN constraint
+                if (i->isBNN()) {
+                    *j++ = *i;
+                    const lbool val = bnn_prop(i->get_bnn(), currLevel, p, i->get_bnn_prop_t());
+                    if (val == l_False) confl = PropBy(i->get_bnn(), nullptr);
+                    continue;
+                }
+
+                //propagate normal clause
+                assert(i->isClause());
+                if (in_flight && i < pf && value(i->getBlockedLit()) != l_True) in_flight--;
+                prop_long_cl_any_order<inprocess, red_also, distill_use>(i, j, p, confl, currLevel);
+            }
+            while (i != end) {
+                *j++ = *i++;
+            }
+            ws.shrink_(end-j);
         }
-        ws.shrink_(end-j);
         VERBOSE_PRINT("prop went through watchlist of " << p);
 
         //distillation would need to generate TBDD proofs to simplify clauses with GJ
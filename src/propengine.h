@@ -43,6 +43,8 @@ THE SOFTWARE.
 #include "cnf.h"
 #include "watchalgos.h"
 #include "gqueuedata.h"
+#include "cpufeatures.h"
+#include "watchsearch.h"
 #include <random>
 
 using std::mt19937_64;
@@ -216,6 +218,7 @@ public:
     void reverse_prop(const Lit l);
     void reverse_one_bnn(uint32_t idx, BNNPropType t);
     PropStats propStats;
+    FindNonFalse find_non_false; ///<New watch search for long clauses
     template<bool inprocess>
     void enqueue(const Lit p, const uint32_t level,
                  const PropBy from = PropBy(), const bool do_unit_frat = true);
@@ -280,6 +283,21 @@ protected:
     uint32_t            qhead;            ///< Head of queue (as index into the trail)
     Lit                 failBinLit;       ///< Used to store which watches[lit] we were looking through when conflict occured
 
+    //The clauses in the shared region are used by all threads at the same
+    //time, so their literals are never reordered. Instead, every thread keeps
+    //the positions of the literals it watches in them here, indexed by
+    //Clause::shared_at. w0 is what c[0] is for other clauses.
+    struct SharedWatch {
+        uint32_t w0;
+        uint32_t w1;
+    };
+    vector<SharedWatch> shared_watch;
+    vector<Lit> shared_reason_tmp;
+    Lit* reason_lits(const ClOffset offset, Clause& c);
+    Lit* shared_reason_lits(const Clause& c);
+    void set_shared_first_watch(const ClOffset offset, const Lit lit);
+    bool attach_shared_clause(const ClOffset offset);
+
     friend class EGaussian;
 
     /////////////////
@@ -352,6 +370,7 @@ protected:
         mem += trail.capacity()*sizeof(Lit);
         mem += trail_lim.capacity()*sizeof(uint32_t);
         mem += toClear.capacity()*sizeof(Lit);
+        mem += shared_watch.capacity()*sizeof(SharedWatch);
         return mem;
     }
 
@@ -391,6 +410,16 @@ private:
         , PropBy& confl
         , uint32_t currLevel
     );
+    template<bool inprocess>
+    bool prop_shared_cl(
+        Watched* i
+        , Watched*& j
+        , const Lit p
+        , PropBy& confl
+        , uint32_t currLevel
+        , const Clause& c
+        , const ClOffset offset
+    );
     void sql_dump_vardata_picktime(uint32_t v, PropBy from);
 
     PropBy gauss_jordan_elim(const Lit p, const uint32_t currLevel);
@@ -463,23 +492,52 @@ inline PropResult PropEngine::prop_normal_helper(
     }
 
     // Look for new watch:
-    for (Lit *k = c.begin() + 2, *end2 = c.end()
-        ; k != end2
-        ; k++
-    ) {
-        //Literal is either unset or satisfied, attach to other watchlist
-        if (value(*k) != l_False) {
-            c[1] = *k;
-            *k = ~p;
-            watches[c[1]].push(Watched(offset, c[0]));
-            return PROP_NOTHING;
+    Lit* k = c.begin() + 2;
+    Lit* const end2 = c.end();
+    const uint32_t bucket = watch_search_bucket(c.size());
+    const uint64_t searches = propStats.watchSearch[bucket]++;
+    const bool sample = searches % PropStats::watch_search_sample_every == 0;
+    const uint64_t start = sample ? cpu_cycles() : 0;
+    if (c.size() < watch_search_simd_min_size) {
+        while (k != end2 && value(*k) == l_False) k++;
+    } else {
+        // Most searches end within the first few literals, only go wide after
+        Lit* const probe_end = k + watch_search_scalar_probe;
+        while (k != probe_end && value(*k) == l_False) k++;
+        if (k == probe_end) {
+            k = find_non_false(k, end2, lit_assigns.data(), lit_assigns.size());
         }
     }
+    if (sample) {
+        propStats.watchSearchSampled[bucket]++;
+        propStats.watchSearchCycles[bucket] += cpu_cycles() - start;
+    }
+
+    //Literal is either unset or satisfied, attach to other watchlist
+    if (k != end2) {
+        c[1] = *k;
+        *k = ~p;
+        watches[c[1]].push(Watched(offset, c[0]));
+        return PROP_NOTHING;
+    }
 
     return PROP_TODO;
 }
 
 
+/**
+@brief Literals of a long clause that is a reason or a conflict
+
+The watched ones come first, so the literal it propagated is the first one.
+Shared clauses are never reordered, for them this is a copy, valid until the
+next call.
+*/
+inline Lit* PropEngine::reason_lits(const ClOffset offset, Clause& c)
+{
+    if (!ClauseAllocator::is_shared(offset)) return c.begin();
+    return shared_reason_lits(c);
+}
+
 template<bool inprocess>
 inline PropResult PropEngine::handle_normal_prop_fail(
     Clause&
@@ -495,7 +553,7 @@ inline PropResult PropEngine::handle_normal_prop_fail(
     cout << "Conflict from cl: " << c << endl;
     #endif
 
-    STATS_DO(if (!inprocess && c.red()) red_stats_extra[c.stats.extra_pos].conflicts_made++);
+    STATS_DO(if (!inprocess && c.red()) red_stats_extra[cl_alloc.red_stats(&c).extra_pos].conflicts_made++);
 
     qhead = trail.size();
     return PROP_FAIL;
@@ -561,8 +619,7 @@ void PropEngine::enqueue(const Lit p, const uint32_t level, const PropBy from, b
     }
     #endif
 
-    const bool sign = p.sign();
-    assigns[v] = boolToLBool(!sign);
+    set_var_value(v, boolToLBool(!p.sign()));
     varData[v].reason = from;
     varData[v].level = level;
     varData[v].sublevel = trail.size();
@@ -577,7 +634,7 @@ void PropEngine::enqueue(const Lit p, const uint32_t level, const PropBy from, b
                 chain.push_back(unit_cl_IDs[from.lit2().var()]);
             } else if (from.getType() == PropByType::clause_t) {
                 Clause* cl = cl_alloc.ptr(from.get_offset());
-                chain.push_back(cl->stats.id);
+                chain.push_back(cl->id);
                 for(auto const& l: *cl) if (l != p) chain.push_back(unit_cl_IDs[l.var()]);
             } else {
                 // These are too difficult and not worth it
@@ -604,7 +661,7 @@ void PropEngine::enqueue(const Lit p, const uint32_t level, const PropBy from, b
 
     if (!inprocess) {
         #ifdef STATS_NEEDED
-        if (sign) {
+        if (p.sign()) {
             propStats.varSetNeg++;
         } else {
             propStats.varSetPos++;
@@ -713,8 +770,7 @@ inline void PropEngine::enqueue_light(const Lit p)
     SLOW_DEBUG_DO(assert(varData[v].removed == Removed::none));
     if (!watches[~p].empty()) watches.prefetch((~p).toInt());
 
-    const bool sign = p.sign();
-    assigns[v] = boolToLBool(!sign);
+    set_var_value(v, boolToLBool(!p.sign()));
     trail.push_back(Trail(p, 1));
     propStats.bogoProps += 1;
 }
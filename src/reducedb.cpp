@@ -66,7 +66,7 @@ struct SortRedClsGlue
     {
         const Clause* x = cl_alloc.ptr(xOff);
         const Clause* y = cl_alloc.ptr(yOff);
-        return x->stats.glue < y->stats.glue;
+        return cl_alloc.red_stats(x).glue < cl_alloc.red_stats(y).glue;
     }
 };
 
@@ -81,7 +81,7 @@ struct SortRedClsAct
     {
         const Clause* x = cl_alloc.ptr(xOff);
         const Clause* y = cl_alloc.ptr(yOff);
-        return x->stats.activity > y->stats.activity;
+        return cl_alloc.red_stats(x).activity > cl_alloc.red_stats(y).activity;
     }
 };
 
@@ -97,7 +97,7 @@ struct SortRedClsUIP1
     {
         const Clause* x = cl_alloc.ptr(xOff);
         const Clause* y = cl_alloc.ptr(yOff);
-        return x->stats.uip1_used > y->stats.uip1_used;
+        return cl_alloc.red_stats(x).uip1_used > cl_alloc.red_stats(y).uip1_used;
     }
 };
 
@@ -112,7 +112,7 @@ struct SortRedClsProps
     {
         const Clause* x = cl_alloc.ptr(xOff);
         const Clause* y = cl_alloc.ptr(yOff);
-        return x->stats.props_made > y->stats.props_made;
+        return cl_alloc.red_stats(x).props_made > cl_alloc.red_stats(y).props_made;
     }
 };
 
@@ -132,8 +132,8 @@ struct SortRedClsPredShort
 
     inline bool operator () (const ClOffset xOff, const ClOffset yOff) const
     {
-        uint32_t x_num = cl_alloc.ptr(xOff)->stats.extra_pos;
-        uint32_t y_num = cl_alloc.ptr(yOff)->stats.extra_pos;
+        uint32_t x_num = cl_alloc.red_stats(cl_alloc.ptr(xOff)).extra_pos;
+        uint32_t y_num = cl_alloc.red_stats(cl_alloc.ptr(yOff)).extra_pos;
         return extdata[x_num].pred_short_use > extdata[y_num].pred_short_use;
     }
 };
@@ -151,8 +151,8 @@ struct SortRedClsPredLong
 
     inline bool operator () (const ClOffset xOff, const ClOffset yOff) const
     {
-        uint32_t x_num = cl_alloc.ptr(xOff)->stats.extra_pos;
-        uint32_t y_num = cl_alloc.ptr(yOff)->stats.extra_pos;
+        uint32_t x_num = cl_alloc.red_stats(cl_alloc.ptr(xOff)).extra_pos;
+        uint32_t y_num = cl_alloc.red_stats(cl_alloc.ptr(yOff)).extra_pos;
         return extdata[x_num].pred_long_use > extdata[y_num].pred_long_use;
     }
 };
@@ -170,8 +170,8 @@ struct SortRedClsPredForever
 
     inline bool operator () (const ClOffset xOff, const ClOffset yOff) const
     {
-        uint32_t x_num = cl_alloc.ptr(xOff)->stats.extra_pos;
-        uint32_t y_num = cl_alloc.ptr(yOff)->stats.extra_pos;
+        uint32_t x_num = cl_alloc.red_stats(cl_alloc.ptr(xOff)).extra_pos;
+        uint32_t y_num = cl_alloc.red_stats(cl_alloc.ptr(yOff)).extra_pos;
         return extdata[x_num].pred_forever_use > extdata[y_num].pred_forever_use;
     }
 };
@@ -199,10 +199,11 @@ void ReduceDB::sort_red_cls(ClauseClean clean_type)
     for(const auto& x: solver->longRedCls[2]) {
         const ClOffset offset = x;
         Clause* cl = solver->cl_alloc.ptr(offset);
-        cout << i << " offset: " << offset << " cl->stats.last_touched_any: " << cl->stats.last_touched_any
-        << " act:" << std::setprecision(9) << cl->stats.activity
-        << " which_red_array:" << cl->stats.which_red_array << endl
-        << " -- cl:" << *cl << " tern:" << cl->stats.is_ternary_resolvent
+        RedClauseStats& red_stats = solver->cl_alloc.red_stats(cl);
+        cout << i << " offset: " << offset << " last_touched_any: " << red_stats.last_touched_any
+        << " act:" << std::setprecision(9) << red_stats.activity
+        << " which_red_array:" << red_stats.which_red_array << endl
+        << " -- cl:" << *cl << " tern:" << cl->is_ternary_resolvent
         << endl;
     }
     #endif
@@ -287,13 +288,13 @@ void ReduceDB::handle_lev2()
 const CMSat::ClauseStats&
 ReduceDB::get_median_stat(const vector<ClOffset>& all_learnt) const
 {
-    return solver->cl_alloc.ptr(all_learnt[all_learnt.size()/2])->stats;
+    return solver->cl_alloc.red_stats(solver->cl_alloc.ptr(all_learnt[all_learnt.size()/2]));
 }
 
 const CMSat::ClauseStats&
 ReduceDB::get_median_stat_dat(const vector<ClOffset>& all_learnt, const vector<val_and_pos>& dat) const
 {
-    return solver->cl_alloc.ptr(all_learnt[dat[dat.size()/2].pos])->stats;
+    return solver->cl_alloc.red_stats(solver->cl_alloc.ptr(all_learnt[dat[dat.size()/2].pos]));
 }
 
 void ReduceDB::prepare_features(vector<ClOffset>& all_learnt)
@@ -309,14 +310,15 @@ void ReduceDB::prepare_features(vector<ClOffset>& all_learnt)
     for(size_t i = 0; i < all_learnt.size(); i++) {
         ClOffset offs = all_learnt[i];
         Clause* cl = solver->cl_alloc.ptr(offs);
-        ClauseStatsExtra& stats_extra = solver->red_stats_extra[cl->stats.extra_pos];
+        RedClauseStats& red_stats = solver->cl_alloc.red_stats(cl);
+        ClauseStatsExtra& stats_extra = solver->red_stats_extra[red_stats.extra_pos];
         stats_extra.prop_ranking = i+1;
-        assert(cl->stats.glue > 0);
-        stats_extra.update_rdb_stats(cl->stats);
+        assert(red_stats.glue > 0);
+        stats_extra.update_rdb_stats(red_stats);
 
-        //total_glue += cl->stats.glue; CANNOT CALCULATE! ternaries have no glues
-        total_props += cl->stats.props_made;
-        total_uip1_used += cl->stats.uip1_used;
+        //total_glue += red_stats.glue; CANNOT CALCULATE! ternaries have no glues
+        total_props += red_stats.props_made;
+        total_uip1_used += red_stats.uip1_used;
         total_sum_uip1_used += stats_extra.sum_uip1_used;
         total_sum_props_used += stats_extra.sum_props_made;
         assert(solver->sumConflicts >= stats_extra.introduced_at_conflict);
@@ -333,7 +335,7 @@ void ReduceDB::prepare_features(vector<ClOffset>& all_learnt)
     for(size_t i = 0; i < all_learnt.size(); i++) {
         ClOffset offs = all_learnt[i];
         Clause* cl = solver->cl_alloc.ptr(offs);
-        ClauseStatsExtra& stats_extra = solver->red_stats_extra[cl->stats.extra_pos];
+        ClauseStatsExtra& stats_extra = solver->red_stats_extra[solver->cl_alloc.red_stats(cl).extra_pos];
         stats_extra.uip1_ranking = i+1;
     }
     if (all_learnt.empty()) {
@@ -347,7 +349,7 @@ void ReduceDB::prepare_features(vector<ClOffset>& all_learnt)
     for(uint32_t i = 0; i < all_learnt.size(); i++) {
         ClOffset offs = all_learnt[i];
         Clause* cl = solver->cl_alloc.ptr(offs);
-        ClauseStatsExtra& stats_extra = solver->red_stats_extra[cl->stats.extra_pos];
+        ClauseStatsExtra& stats_extra = solver->red_stats_extra[solver->cl_alloc.red_stats(cl).extra_pos];
         dat[i].pos = i;
         dat[i].val = stats_extra.calc_sum_uip1_per_time(solver->sumConflicts);
     }
@@ -355,7 +357,7 @@ void ReduceDB::prepare_features(vector<ClOffset>& all_learnt)
     for(size_t i = 0; i < dat.size(); i++) {
         ClOffset offs = all_learnt[dat[i].pos];
         Clause* cl = solver->cl_alloc.ptr(offs);
-        ClauseStatsExtra& stats_extra = solver->red_stats_extra[cl->stats.extra_pos];
+        ClauseStatsExtra& stats_extra = solver->red_stats_extra[solver->cl_alloc.red_stats(cl).extra_pos];
         stats_extra.sum_uip1_per_time_ranking = i+1;
     }
     if (all_learnt.empty()) {
@@ -370,7 +372,7 @@ void ReduceDB::prepare_features(vector<ClOffset>& all_learnt)
     for(uint32_t i = 0; i < all_learnt.size(); i++) {
         ClOffset offs = all_learnt[i];
         Clause* cl = solver->cl_alloc.ptr(offs);
-        ClauseStatsExtra& stats_extra = solver->red_stats_extra[cl->stats.extra_pos];
+        ClauseStatsExtra& stats_extra = solver->red_stats_extra[solver->cl_alloc.red_stats(cl).extra_pos];
         dat[i].pos = i;
         dat[i].val = stats_extra.calc_sum_props_per_time(solver->sumConflicts);
     }
@@ -378,7 +380,7 @@ void ReduceDB::prepare_features(vector<ClOffset>& all_learnt)
     for(size_t i = 0; i < all_learnt.size(); i++) {
         ClOffset offs = all_learnt[dat[i].pos];
         Clause* cl = solver->cl_alloc.ptr(offs);
-        ClauseStatsExtra& stats_extra = solver->red_stats_extra[cl->stats.extra_pos];
+        ClauseStatsExtra& stats_extra = solver->red_stats_extra[solver->cl_alloc.red_stats(cl).extra_pos];
         stats_extra.sum_props_per_time_ranking = i+1;
     }
     if (all_learnt.empty()) {
@@ -396,17 +398,18 @@ void ReduceDB::prepare_features(vector<ClOffset>& all_learnt)
         ClOffset offs = all_learnt[i];
         Clause* cl = solver->cl_alloc.ptr(offs);
         dat[i].pos = i;
-        dat[i].val = cl->stats.activity;
+        dat[i].val = solver->cl_alloc.red_stats(cl).activity;
     }
     std::sort(dat.begin(), dat.end(), SortValAndPos());
     for(size_t i = 0; i < all_learnt.size(); i++) {
         ClOffset offs = all_learnt[dat[i].pos];
         Clause* cl = solver->cl_alloc.ptr(offs);
-        ClauseStatsExtra& stats_extra = solver->red_stats_extra[cl->stats.extra_pos];
+        RedClauseStats& red_stats = solver->cl_alloc.red_stats(cl);
+        ClauseStatsExtra& stats_extra = solver->red_stats_extra[red_stats.extra_pos];
         stats_extra.act_ranking = i+1;
 
         new_red_stats_extra[new_extra_pos] = stats_extra;
-        cl->stats.extra_pos = new_extra_pos;
+        red_stats.extra_pos = new_extra_pos;
         new_extra_pos++;
     }
     if (all_learnt.empty()) {
@@ -435,16 +438,17 @@ void ReduceDB::dump_sql_cl_data(
         auto& cc = solver->longRedCls[lev];
         for(const auto& offs: cc) {
             Clause* cl = solver->cl_alloc.ptr(offs);
+            RedClauseStats& red_stats = solver->cl_alloc.red_stats(cl);
             assert(!cl->get_removed());
             assert(cl->red());
             assert(!cl->freed());
-            if (cl->stats.locked_for_data_gen) {
-                assert(cl->stats.which_red_array == 0);
-            } else if (cl->stats.which_red_array == 0) {
+            if (red_stats.locked_for_data_gen) {
+                assert(red_stats.which_red_array == 0);
+            } else if (red_stats.which_red_array == 0) {
                 non_locked_lev0++;
             }
             all_learnt.push_back(offs);
-            num_locked_for_data_gen += cl->stats.locked_for_data_gen;
+            num_locked_for_data_gen += red_stats.locked_for_data_gen;
         }
     }
     if (all_learnt.empty()) {
@@ -478,12 +482,13 @@ void ReduceDB::dump_sql_cl_data(
     for(size_t i = 0; i < all_learnt.size(); i++) {
         ClOffset offs = all_learnt[i];
         Clause* cl = solver->cl_alloc.ptr(offs);
-        if (!cl->stats.is_tracked) continue;
+        RedClauseStats& red_stats = solver->cl_alloc.red_stats(cl);
+        if (!cl->is_tracked) continue;
 
         const bool locked = solver->clause_locked(*cl, offs);
-        ClauseStatsExtra& stats_extra = solver->red_stats_extra[cl->stats.extra_pos];
+        ClauseStatsExtra& stats_extra = solver->red_stats_extra[red_stats.extra_pos];
         assert(stats_extra.orig_ID != 0);
-        assert(stats_extra.orig_ID <= cl->stats.ID);
+        assert(stats_extra.orig_ID <= cl->id);
         solver->sqlStats->reduceDB(
             solver
             , locked
@@ -491,7 +496,7 @@ void ReduceDB::dump_sql_cl_data(
             , reduceDB_called
         );
         added_to_db++;
-        stats_extra.reset_rdb_stats(cl->stats);
+        stats_extra.reset_rdb_stats(red_stats);
     }
     solver->sqlStats->end_transaction();
 
@@ -525,36 +530,37 @@ void ReduceDB::handle_lev1()
     ) {
         const ClOffset offset = solver->longRedCls[1][i];
         Clause* cl = solver->cl_alloc.ptr(offset);
+        RedClauseStats& red_stats = solver->cl_alloc.red_stats(cl);
         #ifdef VERBOSE_DEBUG
-        cout << "offset: " << offset << " cl->stats.last_touched_any: " << cl->stats.last_touched_any
-        << " act:" << std::setprecision(9) << cl->stats.activity
-        << " which_red_array:" << cl->stats.which_red_array << endl
-        << " -- cl:" << *cl << " tern:" << cl->stats.is_ternary_resolvent
+        cout << "offset: " << offset << " last_touched_any: " << red_stats.last_touched_any
+        << " act:" << std::setprecision(9) << red_stats.activity
+        << " which_red_array:" << red_stats.which_red_array << endl
+        << " -- cl:" << *cl << " tern:" << cl->is_ternary_resolvent
         << endl;
         #endif
 
-        assert(!cl->stats.locked_for_data_gen);
-        if (cl->stats.which_red_array == 0) {
+        assert(!red_stats.locked_for_data_gen);
+        if (red_stats.which_red_array == 0) {
             solver->longRedCls[0].push_back(offset);
             moved_w0++;
-        } else if (cl->stats.which_red_array == 2) {
+        } else if (red_stats.which_red_array == 2) {
             assert(false && "we should never move up through any other means");
         } else {
             uint32_t must_touch = solver->conf.must_touch_lev1_within;
-            if (cl->stats.is_ternary_resolvent) {
+            if (cl->is_ternary_resolvent) {
                 must_touch *= solver->conf.ternary_keep_mult; //this multiplier is 6 by default
             }
             if (!solver->clause_locked(*cl, offset)
-                && cl->stats.last_touched_any + must_touch < solver->sumConflicts
+                && red_stats.last_touched_any + must_touch < solver->sumConflicts
             ) {
                 solver->longRedCls[2].push_back(offset);
-                cl->stats.which_red_array = 2;
+                red_stats.which_red_array = 2;
 
                 //when stats are needed, activities are correctly updated
                 //across all clauses
                 //WARNING this changes the way things behave during STATS relative to non-STATS!
                 #ifndef STATS_NEEDED
-                cl->stats.activity = 0;
+                red_stats.activity = 0;
                 solver->bump_cl_act<false>(cl);
                 #endif
                 non_recent_use++;
@@ -602,7 +608,8 @@ void ReduceDB::pred_move_to_lev1_and_lev0()
     for(uint32_t i = 0; i < solver->longRedCls[2].size(); i ++) {
         const ClOffset offset = solver->longRedCls[2][i];
         Clause* cl = solver->cl_alloc.ptr(offset);
-        const auto& stats_extra = solver->red_stats_extra[cl->stats.extra_pos];
+        RedClauseStats& red_stats = solver->cl_alloc.red_stats(cl);
+        const auto& stats_extra = solver->red_stats_extra[red_stats.extra_pos];
 
         bool move = false;
         if (solver->conf.pred_forever_cutoff == 0) {
@@ -615,7 +622,7 @@ void ReduceDB::pred_move_to_lev1_and_lev0()
 
         if (move) {
             moved_from_T2_to_T0++;
-            cl->stats.which_red_array = 0;
+            red_stats.which_red_array = 0;
             solver->longRedCls[0].push_back(offset);
         } else {
             solver->longRedCls[2][j++] =solver->longRedCls[2][i];
@@ -637,7 +644,7 @@ void ReduceDB::pred_move_to_lev1_and_lev0()
         Clause* cl = solver->cl_alloc.ptr(offset);
         if (i < mark_long) {
             moved_from_T2_to_T1++;
-            cl->stats.which_red_array = 1;
+            solver->cl_alloc.red_stats(cl).which_red_array = 1;
             solver->longRedCls[1].push_back(offset);
         } else {
             solver->longRedCls[2][j++] =solver->longRedCls[2][i];
@@ -661,7 +668,7 @@ void ReduceDB::update_preds(const vector<ClOffset>& offs)
     ) {
         const ClOffset offset = offs[i];
         Clause* cl = solver->cl_alloc.ptr(offset);
-        auto& stats_extra = solver->red_stats_extra[cl->stats.extra_pos];
+        auto& stats_extra = solver->red_stats_extra[solver->cl_alloc.red_stats(cl).extra_pos];
 
         double act_ranking_rel = safe_div(stats_extra.act_ranking, commdata.all_learnt_size);
         double uip1_ranking_rel = safe_div(stats_extra.uip1_ranking, commdata.all_learnt_size);
@@ -700,7 +707,7 @@ void ReduceDB::update_preds(const vector<ClOffset>& offs)
     uint32_t retrieve_at = 0;
     for(const auto& offset: offs) {
         Clause* cl = solver->cl_alloc.ptr(offset);
-        auto& stats_extra = solver->red_stats_extra[cl->stats.extra_pos];
+        auto& stats_extra = solver->red_stats_extra[solver->cl_alloc.red_stats(cl).extra_pos];
 
         assert(stats_extra.introduced_at_conflict <= solver->sumConflicts);
         uint64_t age = solver->sumConflicts - stats_extra.introduced_at_conflict;
@@ -754,7 +761,7 @@ void ReduceDB::clean_lev0_once_in_a_while()
     for(uint32_t i = 0; i < solver->longRedCls[0].size(); i ++) {
         const ClOffset offset = solver->longRedCls[0][i];
         Clause* cl = solver->cl_alloc.ptr(offset);
-        auto& stats_extra = solver->red_stats_extra[cl->stats.extra_pos];
+        auto& stats_extra = solver->red_stats_extra[solver->cl_alloc.red_stats(cl).extra_pos];
         assert(!cl->freed());
 
         uint32_t time_inside_solver = solver->sumConflicts - stats_extra.introduced_at_conflict;
@@ -788,7 +795,7 @@ void ReduceDB::clean_lev0_once_in_a_while()
         if (keep) {
             //cout << "stats_extra.pred_forever_use: " << stats_extra.pred_forever_use/(10*1000.0) << endl;
             kept_in_T0++;
-            assert(cl->stats.which_red_array == 0);
+            assert(solver->cl_alloc.red_stats(cl).which_red_array == 0);
             solver->longRedCls[0][j++] = solver->longRedCls[0][i];
         } else {
             moved_from_T0_to_T1++;
@@ -796,7 +803,7 @@ void ReduceDB::clean_lev0_once_in_a_while()
             //if locked, move anyway, even though we are supposed to delete
             if (solver->conf.move_from_tier0 == 1 || solver->clause_locked(*cl, offset)) {
                 solver->longRedCls[1].push_back(offset);
-                cl->stats.which_red_array = 1;
+                solver->cl_alloc.red_stats(cl).which_red_array = 1;
             } else {
                 solver->watches.smudge((*cl)[0]);
                 solver->watches.smudge((*cl)[1]);
@@ -846,7 +853,7 @@ void ReduceDB::clean_lev1_once_in_a_while()
     for(uint32_t i = 0; i < solver->longRedCls[1].size(); i ++) {
         const ClOffset offset = solver->longRedCls[1][i];
         Clause* cl = solver->cl_alloc.ptr(offset);
-        auto& stats_extra = solver->red_stats_extra[cl->stats.extra_pos];
+        auto& stats_extra = solver->red_stats_extra[solver->cl_alloc.red_stats(cl).extra_pos];
         assert(!cl->freed());
 
         uint32_t time_inside_solver = solver->sumConflicts - stats_extra.introduced_at_conflict;
@@ -867,14 +874,14 @@ void ReduceDB::clean_lev1_once_in_a_while()
             }
 
             kept_in_T1++;
-            assert(cl->stats.which_red_array == 1);
+            assert(solver->cl_alloc.red_stats(cl).which_red_array == 1);
             solver->longRedCls[1][j++] =solver->longRedCls[1][i];
         } else {
             moved_from_T1_to_T2++;
             //if locked, we'll move it anyway, since we can't delete
             if (solver->conf.move_from_tier1 == 1 || solver->clause_locked(*cl, offset)) {
                 solver->longRedCls[2].push_back(offset);
-                cl->stats.which_red_array = 2;
+                solver->cl_alloc.red_stats(cl).which_red_array = 2;
             } else {
                 solver->watches.smudge((*cl)[0]);
                 solver->watches.smudge((*cl)[1]);
@@ -917,7 +924,7 @@ void ReduceDB::delete_from_lev2()
     for(uint32_t i = 0; i < solver->longRedCls[2].size(); i ++) {
         const ClOffset offset = solver->longRedCls[2][i];
         Clause* cl = solver->cl_alloc.ptr(offset);
-        auto& stats_extra = solver->red_stats_extra[cl->stats.extra_pos];
+        auto& stats_extra = solver->red_stats_extra[solver->cl_alloc.red_stats(cl).extra_pos];
         assert(!cl->freed());
 
         assert(stats_extra.introduced_at_conflict <= solver->sumConflicts);
@@ -955,14 +962,15 @@ ReduceDB::ClauseStats ReduceDB::reset_clause_dats(const uint32_t lev)
     uint32_t tot_age = 0;
     for(const auto& off: solver->longRedCls[lev]) {
         Clause* cl = solver->cl_alloc.ptr(off);
-        auto& stats_extra = solver->red_stats_extra[cl->stats.extra_pos];
+        RedClauseStats& red_stats = solver->cl_alloc.red_stats(cl);
+        auto& stats_extra = solver->red_stats_extra[red_stats.extra_pos];
         assert(!cl->freed());
 
         assert(stats_extra.introduced_at_conflict <= solver->sumConflicts);
         const uint64_t age = solver->sumConflicts - stats_extra.introduced_at_conflict;
         tot_age += age;
         cl_stat.add_in(*cl, age, stats_extra.orig_size);
-        stats_extra.reset_rdb_stats(cl->stats);
+        stats_extra.reset_rdb_stats(red_stats);
     }
 
     /*if (solver->conf.verbosity) {
@@ -996,7 +1004,7 @@ void ReduceDB::dump_pred_distrib(const vector<ClOffset>& offs, uint32_t lev) {
     std::ofstream distrib_file("pred_distrib.csv", ios::app);
     for(const auto& off:offs) {
         Clause* cl = solver->cl_alloc.ptr(off);
-        ClauseStatsExtra& stats_extra = solver->red_stats_extra[cl->stats.extra_pos];
+        ClauseStatsExtra& stats_extra = solver->red_stats_extra[solver->cl_alloc.red_stats(cl).extra_pos];
         const uint64_t age = solver->sumConflicts - stats_extra.introduced_at_conflict;
         if (age > solver->conf.every_pred_reduce)  {
             distrib_file
@@ -1192,17 +1200,18 @@ void ReduceDB::mark_top_N_clauses_lev2(const uint64_t keep_num)
     ) {
         const ClOffset offset = solver->longRedCls[2][i];
         Clause* cl = solver->cl_alloc.ptr(offset);
+        RedClauseStats& red_stats = solver->cl_alloc.red_stats(cl);
         #ifdef VERBOSE_DEBUG
-        cout << "offset: " << offset << " cl->stats.last_touched_any: " << cl->stats.last_touched_any
-        << " act:" << std::setprecision(9) << cl->stats.activity
-        << " which_red_array:" << cl->stats.which_red_array << endl
-        << " -- cl:" << *cl << " tern:" << cl->stats.is_ternary_resolvent
+        cout << "offset: " << offset << " last_touched_any: " << red_stats.last_touched_any
+        << " act:" << std::setprecision(9) << red_stats.activity
+        << " which_red_array:" << red_stats.which_red_array << endl
+        << " -- cl:" << *cl << " tern:" << cl->is_ternary_resolvent
         << endl;
         #endif
 
-        if (cl->stats.ttl > 0
+        if (red_stats.ttl > 0
             || solver->clause_locked(*cl, offset)
-            || cl->stats.which_red_array != 2
+            || red_stats.which_red_array != 2
         ) {
             //no need to mark, skip
             #ifdef VERBOSE_DEBUG
@@ -1211,9 +1220,9 @@ void ReduceDB::mark_top_N_clauses_lev2(const uint64_t keep_num)
             continue;
         }
 
-        if (!cl->stats.marked_clause) {
+        if (!cl->marked_clause) {
             marked++;
-            cl->stats.marked_clause = true;
+            cl->marked_clause = true;
             #ifdef VERBOSE_DEBUG
             cout << "Not marking Skipping "<< endl;
             #endif
@@ -1224,8 +1233,8 @@ void ReduceDB::mark_top_N_clauses_lev2(const uint64_t keep_num)
 bool ReduceDB::cl_needs_removal(const Clause* cl, const ClOffset offset) const
 {
     assert(cl->red());
-    return !cl->stats.marked_clause
-         && cl->stats.ttl == 0
+    return !cl->marked_clause
+         && solver->cl_alloc.red_stats(cl).ttl == 0
          && !solver->clause_locked(*cl, offset);
 }
 
@@ -1237,31 +1246,32 @@ void ReduceDB::remove_cl_from_lev2() {
     ) {
         ClOffset offset = solver->longRedCls[2][i];
         Clause* cl = solver->cl_alloc.ptr(offset);
+        RedClauseStats& red_stats = solver->cl_alloc.red_stats(cl);
         assert(cl->size() > 2);
 
         //move to another array
-        if (cl->stats.which_red_array < 2) {
-            cl->stats.marked_clause = 0;
-            solver->longRedCls[cl->stats.which_red_array].push_back(offset);
+        if (red_stats.which_red_array < 2) {
+            cl->marked_clause = 0;
+            solver->longRedCls[red_stats.which_red_array].push_back(offset);
             continue;
         }
-        assert(cl->stats.which_red_array == 2);
+        assert(red_stats.which_red_array == 2);
 
         //Check if locked, or marked or ttl-ed
-        if (cl->stats.marked_clause) {
+        if (cl->marked_clause) {
             cl_marked++;
-        } else if (cl->stats.ttl != 0) {
+        } else if (red_stats.ttl != 0) {
             cl_ttl++;
         } else if (solver->clause_locked(*cl, offset)) {
             cl_locked_solver++;
         }
 
         if (!cl_needs_removal(cl, offset)) {
-            if (cl->stats.ttl == 1) {
-                cl->stats.ttl = 0;
+            if (red_stats.ttl == 1) {
+                red_stats.ttl = 0;
             }
             solver->longRedCls[2][j++] = offset;
-            cl->stats.marked_clause = 0;
+            cl->marked_clause = 0;
             continue;
         }
 
@@ -1273,10 +1283,10 @@ void ReduceDB::remove_cl_from_lev2() {
         *solver->frat << del << *cl << fin;
         cl->set_removed();
         #ifdef VERBOSE_DEBUG
-        cout << "REMOVING offset: " << offset << " cl->stats.last_touched_any: " << cl->stats.last_touched_any
-        << " act:" << std::setprecision(9) << cl->stats.activity
-        << " which_red_array:" << cl->stats.which_red_array << endl
-        << " -- cl:" << *cl << " tern:" << cl->stats.is_ternary_resolvent
+        cout << "REMOVING offset: " << offset << " last_touched_any: " << red_stats.last_touched_any
+        << " act:" << std::setprecision(9) << red_stats.activity
+        << " which_red_array:" << red_stats.which_red_array << endl
+        << " -- cl:" << *cl << " tern:" << cl->is_ternary_resolvent
         << endl;
         #endif
         delayed_clause_free.push_back(offset);
@@ -1303,14 +1313,14 @@ ReduceDB::ClauseStats ReduceDB::ClauseStats::operator += (const ClauseStats& oth
 void ReduceDB::ClauseStats::add_in(const Clause& cl, const uint64_t age, const uint32_t orig_size)
 {
     total_cls++;
-    total_props += cl.stats.props_made;
-    total_uip1_used += cl.stats.uip1_used;
+    total_props += solver->cl_alloc.red_stats(&cl).props_made;
+    total_uip1_used += solver->cl_alloc.red_stats(&cl).uip1_used;
     total_age += age;
     total_len += cl.size();
-    total_ternary += cl.stats.is_ternary_resolvent;
+    total_ternary += cl.is_ternary_resolvent;
     total_distilled += cl.distilled;
     total_orig_size += orig_size;
-    //total_glue += cl.stats.glue; CANNOT DO, ternaries have no glue
+    //total_glue += solver->cl_alloc.red_stats(&cl).glue; CANNOT DO, ternaries have no glue
 }
 #endif
 
@@ -0,0 +1,327 @@
+/*************************************************************
+CryptoMiniSat --- Copyright (C) 2009-2020 Authors of CryptoMiniSat, see AUTHORS file
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+***************************************************************/
+
+#include "rowkernels.h"
+#include "cpufeatures.h"
+
+#ifdef CMS_X86_DISPATCH
+#include <immintrin.h>
+#endif
+
+using namespace CMSat;
+
+static void xor_into_scalar(int64_t* a, const int64_t* b, uint32_t n)
+{
+    for (uint32_t i = 0; i < n; i++) a[i] ^= b[i];
+}
+
+static void set_xor_scalar(int64_t* out, const int64_t* a, const int64_t* b, uint32_t n)
+{
+    for (uint32_t i = 0; i < n; i++) out[i] = a[i] ^ b[i];
+}
+
+static void and_inv_scalar(int64_t* a, const int64_t* b, uint32_t n)
+{
+    for (uint32_t i = 0; i < n; i++) a[i] &= ~b[i];
+}
+
+static void set_and_inv_scalar(int64_t* out, const int64_t* a, const int64_t* b, uint32_t n)
+{
+    for (uint32_t i = 0; i < n; i++) out[i] = a[i] & ~b[i];
+}
+
+static void set_and_scalar(int64_t* out, const int64_t* a, const int64_t* b, uint32_t n)
+{
+    for (uint32_t i = 0; i < n; i++) out[i] = a[i] & b[i];
+}
+
+static uint32_t set_and_popcnt_atleast2_scalar(int64_t* out, const int64_t* a, const int64_t* b, uint32_t n)
+{
+    uint32_t pop = 0;
+    for (uint32_t i = 0; i < n && pop < 2; i++) {
+        out[i] = a[i] & b[i];
+        pop += __builtin_popcountll((uint64_t)out[i]);
+    }
+    return pop;
+}
+
+static uint32_t popcnt_scalar(const int64_t* a, uint32_t n)
+{
+    uint32_t pop = 0;
+    for (uint32_t i = 0; i < n; i++) pop += __builtin_popcountll((uint64_t)a[i]);
+    return pop;
+}
+
+static const RowKernels kernels_scalar = {
+    xor_into_scalar,
+    set_xor_scalar,
+    and_inv_scalar,
+    set_and_inv_scalar,
+    set_and_scalar,
+    set_and_popcnt_atleast2_scalar,
+    popcnt_scalar,
+    "scalar"
+};
+
+#ifdef CMS_X86_DISPATCH
+// The AVX2 kernels do 4 words at a time and the rest with the scalar loop.
+// The AVX-512 ones do 8 at a time and the rest as the AVX2 ones. A masked
+// store for the rest was much slower when 'out' is also 'a'.
+
+#define AVX2_BINARY_KERNEL(name, expr, scalar_expr) \
+__attribute__((target("avx2"))) \
+static void name(int64_t* out, const int64_t* a, const int64_t* b, uint32_t n) \
+{ \
+    uint32_t i = 0; \
+    for (; i + 4 <= n; i += 4) { \
+        const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i)); \
+        const __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i)); \
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), expr); \
+    } \
+    for (; i < n; i++) out[i] = scalar_expr; \
+}
+
+AVX2_BINARY_KERNEL(set_xor_avx2, _mm256_xor_si256(va, vb), a[i] ^ b[i])
+AVX2_BINARY_KERNEL(set_and_inv_avx2, _mm256_andnot_si256(vb, va), a[i] & ~b[i])
+AVX2_BINARY_KERNEL(set_and_avx2, _mm256_and_si256(va, vb), a[i] & b[i])
+
+static void xor_into_avx2(int64_t* a, const int64_t* b, uint32_t n)
+{
+    set_xor_avx2(a, a, b, n);
+}
+
+static void and_inv_avx2(int64_t* a, const int64_t* b, uint32_t n)
+{
+    set_and_inv_avx2(a, a, b, n);
+}
+
+__attribute__((target("avx2")))
+static uint32_t set_and_popcnt_atleast2_avx2(int64_t* out, const int64_t* a, const int64_t* b, uint32_t n)
+{
+    uint32_t pop = 0;
+    uint32_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        const __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        const __m256i v = _mm256_and_si256(va, vb);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), v);
+        if (!_mm256_testz_si256(v, v)) {
+            for (uint32_t j = i; j < i + 4; j++) pop += __builtin_popcountll((uint64_t)out[j]);
+            if (pop >= 2) return pop;
+        }
+    }
+    for (; i < n && pop < 2; i++) {
+        out[i] = a[i] & b[i];
+        pop += __builtin_popcountll((uint64_t)out[i]);
+    }
+    return pop;
+}
+
+// Nibble lookup, summed per 64-bit lane with SAD, see Mula et al.,
+// "Faster Population Counts Using AVX2 Instructions". On short rows it's
+// slower than the popcnt instruction
+__attribute__((target("avx2")))
+static uint32_t popcnt_avx2(const int64_t* a, uint32_t n)
+{
+    if (n < 16) return popcnt_scalar(a, n);
+
+    const __m256i lookup = _mm256_setr_epi8(
+        0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+        0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i low_mask = _mm256_set1_epi8(0x0f);
+    __m256i acc = _mm256_setzero_si256();
+    uint32_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        const __m256i lo = _mm256_and_si256(v, low_mask);
+        const __m256i hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), low_mask);
+        const __m256i cnt = _mm256_add_epi8(
+            _mm256_shuffle_epi8(lookup, lo), _mm256_shuffle_epi8(lookup, hi));
+        acc = _mm256_add_epi64(acc, _mm256_sad_epu8(cnt, _mm256_setzero_si256()));
+    }
+    uint32_t pop = _mm256_extract_epi64(acc, 0) + _mm256_extract_epi64(acc, 1)
+        + _mm256_extract_epi64(acc, 2) + _mm256_extract_epi64(acc, 3);
+    for (; i < n; i++) pop += __builtin_popcountll((uint64_t)a[i]);
+    return pop;
+}
+
+static const RowKernels kernels_avx2 = {
+    xor_into_avx2,
+    set_xor_avx2,
+    and_inv_avx2,
+    set_and_inv_avx2,
+    set_and_avx2,
+    set_and_popcnt_atleast2_avx2,
+    popcnt_avx2,
+    "avx2"
+};
+
+static inline __mmask8 tail_mask(const uint32_t left)
+{
+    return (__mmask8)((1U << left) - 1);
+}
+
+// GCC's horizontal sum intrinsic warns about an uninitialized temporary
+__attribute__((target("avx512f")))
+static inline uint32_t sum_lanes(const __m512i acc)
+{
+    alignas(64) uint64_t lanes[8];
+    _mm512_store_si512(lanes, acc);
+    uint64_t sum = 0;
+    for (const uint64_t l: lanes) sum += l;
+    return sum;
+}
+
+#define AVX512_BINARY_KERNEL(name, expr, tail_kernel) \
+__attribute__((target("avx512f,avx512bw"))) \
+static void name(int64_t* out, const int64_t* a, const int64_t* b, uint32_t n) \
+{ \
+    uint32_t i = 0; \
+    for (; i + 8 <= n; i += 8) { \
+        const __m512i va = _mm512_loadu_si512(a + i); \
+        const __m512i vb = _mm512_loadu_si512(b + i); \
+        _mm512_storeu_si512(out + i, expr); \
+    } \
+    if (i < n) tail_kernel(out + i, a + i, b + i, n - i); \
+}
+
+AVX512_BINARY_KERNEL(set_xor_avx512, _mm512_xor_si512(va, vb), set_xor_avx2)
+AVX512_BINARY_KERNEL(set_and_inv_avx512, _mm512_and_si512(va, _mm512_xor_si512(vb, _mm512_set1_epi64(-1))), set_and_inv_avx2)
+AVX512_BINARY_KERNEL(set_and_avx512, _mm512_and_si512(va, vb), set_and_avx2)
+
+static void xor_into_avx512(int64_t* a, const int64_t* b, uint32_t n)
+{
+    set_xor_avx512(a, a, b, n);
+}
+
+static void and_inv_avx512(int64_t* a, const int64_t* b, uint32_t n)
+{
+    set_and_inv_avx512(a, a, b, n);
+}
+
+__attribute__((target("avx512f,avx512bw")))
+static uint32_t set_and_popcnt_atleast2_avx512(int64_t* out, const int64_t* a, const int64_t* b, uint32_t n)
+{
+    uint32_t pop = 0;
+    uint32_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        const __m512i v = _mm512_and_si512(_mm512_loadu_si512(a + i), _mm512_loadu_si512(b + i));
+        _mm512_storeu_si512(out + i, v);
+        uint32_t nonzero = _mm512_test_epi64_mask(v, v);
+        while (nonzero) {
+            pop += __builtin_popcountll((uint64_t)out[i + __builtin_ctz(nonzero)]);
+            nonzero &= nonzero - 1;
+        }
+        if (pop >= 2) return pop;
+    }
+    if (i < n) pop += set_and_popcnt_atleast2_avx2(out + i, a + i, b + i, n - i);
+    return pop;
+}
+
+__attribute__((target("avx512f,avx512bw")))
+static uint32_t popcnt_avx512(const int64_t* a, uint32_t n)
+{
+    const __m512i lookup = _mm512_set4_epi32(
+        0x04030302, 0x03020201, 0x03020201, 0x02010100);
+    const __m512i low_mask = _mm512_set1_epi8(0x0f);
+    __m512i acc = _mm512_setzero_si512();
+    for (uint32_t i = 0; i < n; i += 8) {
+        const __mmask8 m = n - i >= 8 ? (__mmask8)0xff : tail_mask(n - i);
+        const __m512i v = _mm512_maskz_loadu_epi64(m, a + i);
+        const __m512i lo = _mm512_and_si512(v, low_mask);
+        const __m512i hi = _mm512_and_si512(_mm512_srli_epi16(v, 4), low_mask);
+        const __m512i cnt = _mm512_add_epi8(
+            _mm512_shuffle_epi8(lookup, lo), _mm512_shuffle_epi8(lookup, hi));
+        acc = _mm512_add_epi64(acc, _mm512_sad_epu8(cnt, _mm512_setzero_si512()));
+    }
+    return sum_lanes(acc);
+}
+
+__attribute__((target("avx512f,avx512vpopcntdq")))
+static uint32_t popcnt_avx512_vpopcnt(const int64_t* a, uint32_t n)
+{
+    __m512i acc = _mm512_setzero_si512();
+    for (uint32_t i = 0; i < n; i += 8) {
+        const __mmask8 m = n - i >= 8 ? (__mmask8)0xff : tail_mask(n - i);
+        const __m512i v = _mm512_maskz_loadu_epi64(m, a + i);
+        acc = _mm512_add_epi64(acc, _mm512_popcnt_epi64(v));
+    }
+    return sum_lanes(acc);
+}
+
+static const RowKernels kernels_avx512 = {
+    xor_into_avx512,
+    set_xor_avx512,
+    and_inv_avx512,
+    set_and_inv_avx512,
+    set_and_avx512,
+    set_and_popcnt_atleast2_avx512,
+    popcnt_avx512,
+    "avx512"
+};
+
+static const RowKernels kernels_avx512_vpopcnt = {
+    xor_into_avx512,
+    set_xor_avx512,
+    and_inv_avx512,
+    set_and_inv_avx512,
+    set_and_avx512,
+    set_and_popcnt_atleast2_avx512,
+    popcnt_avx512_vpopcnt,
+    "avx512-vpopcnt"
+};
+#endif
+
+const RowKernels& CMSat::row_kernels_scalar()
+{
+    return kernels_scalar;
+}
+
+const RowKernels& CMSat::get_row_kernels(const bool use_simd)
+{
+    #ifdef CMS_X86_DISPATCH
+    if (use_simd) {
+        const CPUFeatures& feat = cpu_features();
+        if (feat.avx512_popcnt) return kernels_avx512_vpopcnt;
+        if (feat.avx512) return kernels_avx512;
+        if (feat.avx2) return kernels_avx2;
+    }
+    #else
+    (void)use_simd;
+    #endif
+    return kernels_scalar;
+}
+
+std::vector<const RowKernels*> CMSat::available_row_kernels()
+{
+    std::vector<const RowKernels*> ret;
+    ret.push_back(&kernels_scalar);
+    #ifdef CMS_X86_DISPATCH
+    const CPUFeatures& feat = cpu_features();
+    if (feat.avx2) ret.push_back(&kernels_avx2);
+    if (feat.avx512) ret.push_back(&kernels_avx512);
+    if (feat.avx512_popcnt) ret.push_back(&kernels_avx512_vpopcnt);
+    #endif
+    return ret;
+}
+
+const RowKernels& CMSat::row_kernels = CMSat::get_row_kernels(true);
@@ -0,0 +1,68 @@
+/*************************************************************
+CryptoMiniSat --- Copyright (C) 2009-2020 Authors of CryptoMiniSat, see AUTHORS file
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+***************************************************************/
+
+#ifndef ROWKERNELS_H
+#define ROWKERNELS_H
+
+#include <cstdint>
+#include <vector>
+
+namespace CMSat {
+
+// Word-wise operations on the rows of the Gauss-Jordan matrices, see
+// PackedRow. 'n' is the number of 64-bit words. The set_* ones write 'out',
+// which may be the same as 'a'.
+struct RowKernels
+{
+    void (*xor_into)(int64_t* a, const int64_t* b, uint32_t n); //a ^= b
+    void (*set_xor)(int64_t* out, const int64_t* a, const int64_t* b, uint32_t n);
+    void (*and_inv)(int64_t* a, const int64_t* b, uint32_t n); //a &= ~b
+    void (*set_and_inv)(int64_t* out, const int64_t* a, const int64_t* b, uint32_t n);
+    void (*set_and)(int64_t* out, const int64_t* a, const int64_t* b, uint32_t n);
+
+    // As set_and, but may stop once at least 2 bits are set in 'out', the
+    // words after where it stopped are then not written. Returns the number
+    // of bits set in the words written
+    uint32_t (*set_and_popcnt_atleast2)(int64_t* out, const int64_t* a, const int64_t* b, uint32_t n);
+    uint32_t (*popcnt)(const int64_t* a, uint32_t n);
+
+    const char* name;
+};
+
+const RowKernels& row_kernels_scalar();
+
+// Best implementation for this CPU, or the scalar one if use_simd is false
+const RowKernels& get_row_kernels(bool use_simd);
+
+// All implementations this CPU can run, the scalar one first
+std::vector<const RowKernels*> available_row_kernels();
+
+// What PackedRow uses, picked once at startup
+extern const RowKernels& row_kernels;
+
+// Rows shorter than this many words are done with PackedRow's inlined
+// scalar loops, a vector block would mostly be wasted on them
+constexpr uint32_t row_simd_min_words = 4;
+
+}
+
+#endif //ROWKERNELS_H
@@ -0,0 +1,103 @@
+/*************************************************************
+CryptoMiniSat --- Copyright (C) 2009-2020 Authors of CryptoMiniSat, see AUTHORS file
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+***************************************************************/
+
+// Row operations per second of the Gauss-Jordan row kernels, for several
+// matrix widths. Build with "make rowkernels-bench"
+
+#include "rowkernels.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace CMSat;
+using std::vector;
+
+static volatile uint64_t sink;
+
+template<class F>
+static double ops_per_sec(const uint64_t num_ops, F f)
+{
+    const auto start = std::chrono::steady_clock::now();
+    f();
+    const std::chrono::duration<double> t = std::chrono::steady_clock::now() - start;
+    return (double)num_ops/t.count();
+}
+
+static void bench(const RowKernels& k, const uint32_t cols)
+{
+    const uint32_t words = cols/64 + (bool)(cols % 64);
+    const uint32_t rows = 256;
+    //About the same amount of work for every width
+    const uint64_t num_ops = std::max<uint64_t>(20000, 200000000ULL/words);
+
+    std::mt19937_64 mtrand(cols);
+    vector<int64_t> mat((uint64_t)rows*words);
+    for(auto& w: mat) w = mtrand();
+    //Sparse rows, so the popcount-at-least-2 scan goes to the end
+    vector<int64_t> sparse((uint64_t)rows*words, 0);
+    for(uint32_t r = 0; r < rows; r++) sparse[(uint64_t)r*words + mtrand() % words] = 1;
+    vector<int64_t> tmp(words);
+
+    auto row = [&](vector<int64_t>& m, const uint64_t i) {
+        return m.data() + (i % rows)*words;
+    };
+    const double x = ops_per_sec(num_ops, [&] {
+        for(uint64_t i = 0; i < num_ops; i++) k.xor_into(row(mat, i), row(mat, i*7 + 1), words);
+    });
+    const double a = ops_per_sec(num_ops, [&] {
+        for(uint64_t i = 0; i < num_ops; i++) k.set_and(tmp.data(), row(mat, i), row(mat, i*7 + 1), words);
+        sink = tmp[0];
+    });
+    const double p2 = ops_per_sec(num_ops, [&] {
+        uint64_t s = 0;
+        for(uint64_t i = 0; i < num_ops; i++) {
+            s += k.set_and_popcnt_atleast2(tmp.data(), row(sparse, i), row(mat, i*7 + 1), words);
+        }
+        sink = s;
+    });
+    const double p = ops_per_sec(num_ops, [&] {
+        uint64_t s = 0;
+        for(uint64_t i = 0; i < num_ops; i++) s += k.popcnt(row(mat, i), words);
+        sink = s;
+    });
+
+    printf("%-15s cols: %6u  xor: %8.2f  set_and: %8.2f  set_and_pop2: %8.2f  popcnt: %8.2f  Mops/s\n",
+        k.name, cols, x/1e6, a/1e6, p2/1e6, p/1e6);
+}
+
+int main(int argc, char** argv)
+{
+    vector<uint32_t> widths = {256, 512, 1024, 4096, 16384};
+    if (argc > 1) {
+        widths.clear();
+        for(int i = 1; i < argc; i++) widths.push_back(std::atoi(argv[i]));
+    }
+
+    printf("Used by the solver: %s\n", row_kernels.name);
+    for(const uint32_t cols: widths) {
+        for(const RowKernels* k: available_row_kernels()) bench(*k, cols);
+    }
+    return 0;
+}
@@ -293,15 +293,21 @@ void SatZillaFeaturesCalc::calculate_cl_distributions(
     double activity_mean = 0;
     double activity_var = 0;
 
+    //Irredundant clauses have no glue or activity, they count with the defaults
+    const RedClauseStats irred_stats;
+    auto red_stats = [&](const Clause& cl) -> const RedClauseStats& {
+        return cl.red() ? solver->cl_alloc.red_stats(&cl) : irred_stats;
+    };
+
     //Calculate means
     double cla_inc = solver->get_cla_inc();
     for(ClOffset off: clauses)
     {
         const Clause& cl = *solver->cl_alloc.ptr(off);
         size_mean += cl.size();
-        glue_mean += cl.stats.glue;
+        glue_mean += red_stats(cl).glue;
         if (cl.red()) {
-            activity_mean += (double)cl.stats.activity/cla_inc;
+            activity_mean += (double)red_stats(cl).activity/cla_inc;
         }
     }
     size_mean /= clauses.size();
@@ -313,8 +319,8 @@ void SatZillaFeaturesCalc::calculate_cl_distributions(
     {
         const Clause& cl = *solver->cl_alloc.ptr(off);
         size_var += std::pow(size_mean-cl.size(), 2);
-        glue_var += std::pow(glue_mean-cl.stats.glue, 2);
-        activity_var += std::pow(activity_mean-(double)cl.stats.activity/cla_inc, 2);
+        glue_var += std::pow(glue_mean-red_stats(cl).glue, 2);
+        activity_var += std::pow(activity_mean-(double)red_stats(cl).activity/cla_inc, 2);
     }
     size_var /= clauses.size();
     glue_var /= clauses.size();
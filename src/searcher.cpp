@@ -261,9 +261,9 @@ void Searcher::normalClMinim()
 
             case clause_t: {
                 Clause* cl2 = cl_alloc.ptr(reason.get_offset());
-                lits = cl2->begin();
+                lits = reason_lits(reason.get_offset(), *cl2);
                 size = cl2->size()-1;
-                id = cl2->stats.id;
+                id = cl2->id;
                 break;
             }
 
@@ -350,31 +350,32 @@ void Searcher::debug_print_resolving_clause(const PropBy confl) const
 void Searcher::update_glue_from_analysis(Clause* cl)
 {
     assert(cl->red());
-    if (cl->stats.is_ternary_resolvent) {
+    if (cl->is_ternary_resolvent) {
         return;
     }
     const unsigned new_glue = calc_glue(*cl);
+    RedClauseStats& red_stats = cl_alloc.red_stats(cl);
 
-    if (new_glue < cl->stats.glue) {
-        if (cl->stats.glue <= conf.protect_cl_if_improved_glue_below_this_glue_for_one_turn) {
-            cl->stats.ttl = 1;
+    if (new_glue < red_stats.glue) {
+        if (red_stats.glue <= conf.protect_cl_if_improved_glue_below_this_glue_for_one_turn) {
+            red_stats.ttl = 1;
             #if defined(STATS_NEEDED)
-            red_stats_extra[cl->stats.extra_pos].ttl_stats = cl->stats.glue - new_glue;
+            red_stats_extra[red_stats.extra_pos].ttl_stats = red_stats.glue - new_glue;
             #endif
         }
-        cl->stats.glue = new_glue;
+        red_stats.glue = new_glue;
 
         #ifndef FINAL_PREDICTOR
-        if (cl->stats.locked_for_data_gen) {
-            assert(cl->stats.which_red_array == 0);
+        if (red_stats.locked_for_data_gen) {
+            assert(red_stats.which_red_array == 0);
         } else if (new_glue <= conf.glue_put_lev0_if_below_or_eq) {
             //move to lev0 if very low glue
-            cl->stats.which_red_array = 0;
+            red_stats.which_red_array = 0;
         } else if (new_glue <= conf.glue_put_lev1_if_below_or_eq
                 && conf.glue_put_lev1_if_below_or_eq != 0
         ) {
             //move to lev1 if low glue
-            cl->stats.which_red_array = 1;
+            red_stats.which_red_array = 1;
         }
         #endif
      }
@@ -414,9 +415,9 @@ void Searcher::add_lits_to_learnt(
 
         case clause_t : {
             Clause* cl = cl_alloc.ptr(confl.get_offset());
-            id = cl->stats.id;
+            id = cl->id;
             assert(!cl->get_removed());
-            lits = cl->begin();
+            lits = reason_lits(confl.get_offset(), *cl);
             size = cl->size();
             sumAntecedentsLits += cl->size();
             VERBOSE_PRINT("resolving with cl:" << *cl);
@@ -425,7 +426,8 @@ void Searcher::add_lits_to_learnt(
                 stats.resolvs.longRed++;
                 #if defined(STATS_NEEDED) || defined(FINAL_PREDICTOR)
                 antec_data.longRed++;
-                antec_data.glue_long_reds.push(cl->stats.glue);
+                antec_data.glue_long_reds.push(cl_alloc.red_stats(cl).glue);
+                if (!inprocess) cl_alloc.red_stats(cl).uip1_used++;
                 #endif
             } else {
                 stats.resolvs.longIrred++;
@@ -435,31 +437,36 @@ void Searcher::add_lits_to_learnt(
             }
             #if defined(STATS_NEEDED) || defined(FINAL_PREDICTOR)
             antec_data.size_longs.push(cl->size());
-            if (!inprocess) cl->stats.uip1_used++;
             #endif
 
             //If STATS_NEEDED then bump acitvity of ALL clauses
             //and set stats on all clauses
-            if (!inprocess
-                && cl->red()
-                #if !defined(STATS_NEEDED) && !defined(FINAL_PREDICTOR)
-                && cl->stats.which_red_array != 0
-                #endif
-            ) {
-                if (conf.update_glues_on_analyze) update_glue_from_analysis(cl);
-
-                #if !defined(STATS_NEEDED) && !defined(FINAL_PREDICTOR)
-                if (cl->stats.which_red_array == 1)
-                #endif
-                    cl->stats.last_touched_any = sumConflicts;
-
-                //If stats or predictor, bump all because during final
-                //we will need this data and during dump when stats is on
-                //we also need this data.
+            if (!inprocess && cl->red()) {
+                RedClauseStats& red_stats = cl_alloc.red_stats(cl);
+                if (red_stats.imported) {
+                    //Only counted the first time
+                    red_stats.imported = false;
+                    solver->datasync->signal_imported_clause_used();
+                }
                 #if !defined(STATS_NEEDED) && !defined(FINAL_PREDICTOR)
-                if (cl->stats.which_red_array == 2)
+                if (red_stats.which_red_array != 0)
                 #endif
-                    bump_cl_act<inprocess>(cl);
+                {
+                    if (conf.update_glues_on_analyze) update_glue_from_analysis(cl);
+
+                    #if !defined(STATS_NEEDED) && !defined(FINAL_PREDICTOR)
+                    if (red_stats.which_red_array == 1)
+                    #endif
+                        red_stats.last_touched_any = sumConflicts;
+
+                    //If stats or predictor, bump all because during final
+                    //we will need this data and during dump when stats is on
+                    //we also need this data.
+                    #if !defined(STATS_NEEDED) && !defined(FINAL_PREDICTOR)
+                    if (red_stats.which_red_array == 2)
+                    #endif
+                        bump_cl_act<inprocess>(cl);
+                }
             }
             break;
         }
@@ -636,7 +643,7 @@ void Searcher::create_learnt_clause(PropBy confl)
         }
         case clause_t : {
             Clause* cl = cl_alloc.ptr(confl.get_offset());
-            lit0 = (*cl)[0];
+            lit0 = reason_lits(confl.get_offset(), *cl)[0];
             break;
         }
         default: release_assert(false);
@@ -706,7 +713,7 @@ void Searcher::simple_create_learnt_clause(
                 uint32_t size;
                 if (confl.getType() == clause_t) {
                     auto cl = solver->cl_alloc.ptr(confl.get_offset());
-                    lits = cl->getData();
+                    lits = reason_lits(confl.get_offset(), *cl);
                     size = cl->size();
                 } else if (confl.getType() == bnn_t) {
                     auto cl = get_bnn_reason(bnns[confl.getBNNidx()], p);
@@ -932,9 +939,9 @@ bool Searcher::litRedundant(const Lit p, uint32_t abstract_levels)
         switch (type) {
             case clause_t: {
                 Clause* cl = cl_alloc.ptr(reason.get_offset());
-                lits = cl->begin();
+                lits = reason_lits(reason.get_offset(), *cl);
                 size = cl->size()-1;
-                ID = cl->stats.id;
+                ID = cl->id;
                 break;
             }
 
@@ -1074,9 +1081,9 @@ void Searcher::analyze_final_confl_with_assumptions(const Lit p, vector<Lit>& ou
                 int32_t ID;
                 switch(reason.getType()) {
                     case clause_t : {
-                        const Clause& cl = *cl_alloc.ptr(reason.get_offset());
-                        ID = cl.stats.id;
-                        assert(value(cl[0]) == l_True);
+                        Clause& cl = *cl_alloc.ptr(reason.get_offset());
+                        ID = cl.id;
+                        assert(value(reason_lits(reason.get_offset(), cl)[0]) == l_True);
                         for(const Lit lit: cl) {
                             if (varData[lit.var()].level > 0) {
                                 seen[lit.var()] = 1;
@@ -1461,12 +1468,12 @@ void Searcher::attach_and_enqueue_learnt_clause(
             solver->attachClause(*cl, enq);
             if (enq) enqueue<false>(learnt_clause[0], level, PropBy(cl_alloc.get_offset(cl)));
             #if !defined(STATS_NEEDED) && !defined(FINAL_PREDICTOR)
-            if (cl->stats.which_red_array == 2)
+            if (cl_alloc.red_stats(cl).which_red_array == 2)
             #endif
                 bump_cl_act<inprocess>(cl);
 
             #ifdef STATS_NEEDED
-            red_stats_extra[cl->stats.extra_pos].antec_data = antec_data;
+            red_stats_extra[cl_alloc.red_stats(cl).extra_pos].antec_data = antec_data;
             #endif
 
             break;
@@ -1555,7 +1562,7 @@ void Searcher::set_clause_data(
     , const uint32_t old_decision_level
 ) {
     assert(cl->red());
-    auto& stats_extra = red_stats_extra[cl->stats.extra_pos];
+    auto& stats_extra = red_stats_extra[cl_alloc.red_stats(cl).extra_pos];
 
     //definitely a BUG here I think -- should be 2*antec_data.num(), no?
     //however, it's the same as how it's dumped in sqlitestats.cpp
@@ -1651,40 +1658,15 @@ Clause* Searcher::handle_last_confl(
     if (learnt_clause.size() <= 2) {
         cl = nullptr;
     } else {
-        cl = cl_alloc.Clause_new(learnt_clause
-            , sumConflicts
-            , ID
-        );
-        cl->isRed = true;
-        cl->stats.glue = glue;
-        cl->stats.id = ID;
-        #if defined(STATS_NEEDED) || defined(FINAL_PREDICTOR)
-        red_stats_extra.push_back(ClauseStatsExtra());
-        cl->stats.extra_pos = red_stats_extra.size()-1;
-        auto& ext_stats = red_stats_extra[cl->stats.extra_pos];
-        ext_stats.introduced_at_conflict = sumConflicts;
-        ext_stats.orig_glue = glue;
-        ext_stats.orig_size = cl->size();
-        #endif
-        #ifdef STATS_NEEDED
-        cl->stats.is_tracked = to_track;
-        if (cl->stats.is_tracked) ext_stats.orig_ID = ID;
-        if (sqlStats) sqlStats->update_id(ID, ID); // this is how we know it's tracked
-        #endif
-        cl->stats.activity = 0.0f;
-        ClOffset offset = cl_alloc.get_offset(cl);
         unsigned which_arr = 2;
-
+        bool locked_for_data_gen = false;
         #ifdef STATS_NEEDED
-        ext_stats.connects_num_communities = connects_num_communities;
-        ext_stats.orig_connects_num_communities = connects_num_communities;
-        cl->stats.locked_for_data_gen =
+        locked_for_data_gen =
             (double)rnd_uint(solver->mtrand,100000)/100000.0 < conf.lock_for_data_gen_ratio;
         #endif
 
-
         #ifndef FINAL_PREDICTOR
-        if (cl->stats.locked_for_data_gen) {
+        if (locked_for_data_gen) {
             which_arr = 0;
         } else if (glue <= conf.glue_put_lev0_if_below_or_eq) {
             which_arr = 0;
@@ -1700,12 +1682,43 @@ Clause* Searcher::handle_last_confl(
         which_arr = 2;
         #endif
 
+        //Goes to the clause arena of its tier
+        cl = cl_alloc.Clause_new(learnt_clause
+            , sumConflicts
+            , ID
+            , ClauseAllocator::red_region(which_arr)
+        );
+        RedClauseStats& red_stats = cl_alloc.red_stats(cl);
+        red_stats.glue = glue;
+        cl->id = ID;
+        #if defined(STATS_NEEDED) || defined(FINAL_PREDICTOR)
+        red_stats_extra.push_back(ClauseStatsExtra());
+        red_stats.extra_pos = red_stats_extra.size()-1;
+        auto& ext_stats = red_stats_extra[red_stats.extra_pos];
+        ext_stats.introduced_at_conflict = sumConflicts;
+        ext_stats.orig_glue = glue;
+        ext_stats.orig_size = cl->size();
+        #endif
+        #ifdef STATS_NEEDED
+        cl->is_tracked = to_track;
+        if (cl->is_tracked) ext_stats.orig_ID = ID;
+        if (sqlStats) sqlStats->update_id(ID, ID); // this is how we know it's tracked
+        #endif
+        red_stats.activity = 0.0f;
+        ClOffset offset = cl_alloc.get_offset(cl);
+
+        #ifdef STATS_NEEDED
+        ext_stats.connects_num_communities = connects_num_communities;
+        ext_stats.orig_connects_num_communities = connects_num_communities;
+        red_stats.locked_for_data_gen = locked_for_data_gen;
+        #endif
+
         if (which_arr == 0) {
             stats.red_cl_in_which0++;
         }
 
-        cl->stats.which_red_array = which_arr;
-        solver->longRedCls[cl->stats.which_red_array].push_back(offset);
+        red_stats.which_red_array = which_arr;
+        solver->longRedCls[which_arr].push_back(offset);
     }
 
     #ifdef STATS_NEEDED
@@ -1733,7 +1746,7 @@ Clause* Searcher::handle_last_confl(
         #ifdef FINAL_PREDICTOR
         set_clause_data(cl, glue, glue_before_minim, old_decision_level);
         #endif
-        cl->stats.is_decision = is_decision;
+        cl_alloc.red_stats(cl).is_decision = is_decision;
     }
 
     *frat << __PRETTY_FUNCTION__ << " end\n";
@@ -1771,7 +1784,7 @@ bool Searcher::handle_conflict(PropBy confl)
         , glue_before_minim         //return glue before minimization here
         , size_before_minim         //return glue before minimization here
     );
-    solver->datasync->signal_new_long_clause(learnt_clause);
+    solver->datasync->signal_new_long_clause(learnt_clause, glue);
 
     uint32_t connects_num_communities = 0;
     STATS_DO(connects_num_communities = calc_connects_num_communities(learnt_clause));
@@ -2339,7 +2352,7 @@ void Searcher::setup_polarity_strategy()
     polarity_strategy_at++;
 
     if ((polarity_strategy_at % 8) == 0) {
-        for(auto& v: varData) {
+        for(auto v: varData) {
             unif_uint_dist(u, 1);
             v.best_polarity = u(mtrand);
             v.stable_polarity = u(mtrand);
@@ -3073,6 +3086,10 @@ void Searcher::consolidate_watches(const bool full)
     } else {
         watches.consolidate();
     }
+    watches.bins_to_front();
+    if (conf.hugepages) {
+        watches.advise_hugepages();
+    }
     double time_used = cpuTime() - t;
     verb_print(1, "[consolidate] "
     << (full ? "full" : "mini")
@@ -3237,7 +3254,7 @@ void Searcher::cancelUntil(uint32_t blevel)
             if (trail[i].lev <= blevel) {
                 trail[j++] = trail[i];
             } else {
-                assigns[var] = l_Undef;
+                set_var_value(var, l_Undef);
                 if (do_insert_var_order) insert_var_order(var);
             }
         }
@@ -3265,7 +3282,7 @@ void Searcher::cancelUntil_light()
         VERBOSE_PRINT("Canceling lit " << trail[i].lit << " sublevel: " << i);
         const uint32_t var = trail[i].lit.var();
         assert(value(var) != l_Undef);
-        assigns[var] = l_Undef;
+        set_var_value(var, l_Undef);
     }
     trail.resize(trail_lim[0]);
     qhead = trail_lim[0];
@@ -3359,9 +3376,9 @@ ConflictData Searcher::find_conflict_level(PropBy& pb) {
         switch(pb.getType()) {
             case PropByType::clause_t: {
                 Clause& conflCl = *cl_alloc.ptr(pb.get_offset());
-                lits = conflCl.getData();
+                lits = reason_lits(pb.get_offset(), conflCl);
                 size = conflCl.size();
-                ID = conflCl.stats.id;
+                ID = conflCl.id;
                 break;
             }
 
@@ -3400,7 +3417,13 @@ ConflictData Searcher::find_conflict_level(PropBy& pb) {
             }
         }
 
-        if (highestId != 0) {
+        if (highestId != 0
+            && pb.getType() == clause_t
+            && ClauseAllocator::is_shared(pb.get_offset())
+        ) {
+            //'lits' is only a copy
+            set_shared_first_watch(pb.get_offset(), lits[highestId]);
+        } else if (highestId != 0) {
             std::swap(lits[0], lits[highestId]);
             if (highestId > 1 && pb.getType() == clause_t) {
                 removeWCl(watches[lits[highestId]], pb.get_offset());
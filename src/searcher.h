@@ -527,23 +527,24 @@ inline void Searcher::bump_cl_act(Clause* cl)
 
     assert(!cl->get_removed());
 
-    double new_val = cla_inc + (double)cl->stats.activity;
-    cl->stats.activity = (float)new_val;
+    RedClauseStats& red_stats = cl_alloc.red_stats(cl);
+    double new_val = cla_inc + (double)red_stats.activity;
+    red_stats.activity = (float)new_val;
     if (max_cl_act < new_val) {
         max_cl_act = new_val;
     }
 
 
-    if (cl->stats.activity > 1e20F ) {
+    if (red_stats.activity > 1e20F ) {
         // Rescale. For STATS_NEEDED we rescale ALL
         #if !defined(STATS_NEEDED) && !defined (FINAL_PREDICTOR)
         for(ClOffset offs: longRedCls[2]) {
-            cl_alloc.ptr(offs)->stats.activity *= static_cast<float>(1e-20);
+            cl_alloc.red_stats(cl_alloc.ptr(offs)).activity *= static_cast<float>(1e-20);
         }
         #else
         for(auto& lrcs: longRedCls) {
             for(ClOffset offs: lrcs) {
-                cl_alloc.ptr(offs)->stats.activity *= static_cast<float>(1e-20);
+                cl_alloc.red_stats(cl_alloc.ptr(offs)).activity *= static_cast<float>(1e-20);
             }
         }
         #endif
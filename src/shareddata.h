@@ -24,62 +24,410 @@ THE SOFTWARE.
 #define SHARED_DATA_H
 
 #include "solvertypesmini.h"
+#include "cloffset.h"
+#include "numa.h"
 
 #include <vector>
-#include <mutex>
 #include <atomic>
+#include <memory>
+#include <algorithm>
+#include <mutex>
+#include <condition_variable>
 using std::vector;
-using std::mutex;
 
 namespace CMSat {
 
-class SharedData
+/**
+@brief The learnt clauses one thread shares with all the others
+
+Only the thread that owns it writes it, and nobody takes a lock. Clauses are
+stored as [size, glue, lits...] in a ring of 32b words, and every reader
+remembers how far it has read. When a reader is lapped, the clauses it has not
+read yet are lost: this is what keeps the buffer bounded. A reader notices
+that by checking, after copying, whether the writer has reserved the space it
+copied from, like with a seqlock.
+*/
+class ClauseRing
 {
     public:
-        SharedData(const uint32_t _num_threads) : num_threads(_num_threads) { cur_thread_id.store(0); }
-        ~SharedData() {}
+        explicit ClauseRing(const uint32_t _cap) :
+            cap(_cap)
+            , data(new std::atomic<uint32_t>[_cap])
+        {}
+
+        uint32_t capacity() const { return cap; }
+
+        //Only called by the owning thread
+        void push(const Lit* lits, const uint32_t size, const uint32_t glue)
+        {
+            const uint64_t w = written.load(std::memory_order_relaxed);
+            reserved.store(w + size + 2, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
 
-        struct Spec {
-            Spec() : data(new vector<Lit>) {}
-            Spec(const Spec&) = delete;
-            Spec& operator=(const Spec&) = delete;
-
-            Spec(Spec&& other)
-            #ifndef _MSC_VER
-            noexcept
-            #endif
-            : data(std::move(other.data))
-            {
-                other.data = nullptr;
-            }
-            ~Spec() { clear(); }
-            vector<Lit>* data = nullptr;
-            void clear() {
-                delete data;
-                data = nullptr;
+            data[w % cap].store(size, std::memory_order_relaxed);
+            data[(w+1) % cap].store(glue, std::memory_order_relaxed);
+            for(uint32_t i = 0; i < size; i++) {
+                data[(w+2+i) % cap].store(lits[i].toInt(), std::memory_order_relaxed);
             }
-        };
+            written.store(w + size + 2, std::memory_order_release);
+        }
 
-        vector<Spec> bins;
-        std::mutex bin_mutex;
-        vector<lbool> value;
-        std::mutex unit_mutex;
-        std::atomic<int> cur_thread_id;
-        uint32_t num_threads;
+        //Appends what was written since 'at' to 'out', and moves 'at' forward.
+        //Returns false if some clauses got overwritten before they were read
+        bool read(uint64_t& at, vector<uint32_t>& out) const
+        {
+            const uint64_t w = written.load(std::memory_order_acquire);
+            if (w - at > cap) {
+                at = w;
+                return false;
+            }
+
+            const size_t old_size = out.size();
+            for(uint64_t i = at; i < w; i++) {
+                out.push_back(data[i % cap].load(std::memory_order_relaxed));
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            const uint64_t r = reserved.load(std::memory_order_relaxed);
+            if (r - at > cap) {
+                //Beginning may be overwritten, and where clauses start is lost
+                out.resize(old_size);
+                at = w;
+                return false;
+            }
+            at = w;
+            return true;
+        }
+
+        size_t mem_used() const
+        {
+            return cap*sizeof(std::atomic<uint32_t>);
+        }
+
+        MemRange mem_range() const
+        {
+            return MemRange{data.get(), mem_used()};
+        }
+
+    private:
+        const uint32_t cap;
+        std::unique_ptr<std::atomic<uint32_t>[]> data;
+        std::atomic<uint64_t> written{0}; ///<Words, ever, published
+        std::atomic<uint64_t> reserved{0}; ///<Words, ever, being written
+};
+
+/**
+@brief Values of variables at decision level 0, found by any of the threads
+
+Every variable has its own atomic value, so threads set and read them without
+a lock. Values are in segments that are allocated when first needed and never
+move, so a thread that added variables (e.g. BVA) doesn't hold up the others.
+
+Every thread reads all values at every sync. When the threads are on several
+NUMA nodes, there is a copy of the values on each node, and threads read the
+copy of their node. Copy 0 decides which value is set first, the others
+follow it.
+*/
+class SharedUnits
+{
+    public:
+        //One copy per node in 'nodes', or a single copy if it's empty
+        explicit SharedUnits(const vector<int>& _nodes = {}) :
+            nodes(_nodes)
+        {
+            if (nodes.empty()) nodes.push_back(-1);
+            for(size_t c = 0; c < nodes.size(); c++) {
+                copies.emplace_back(new std::atomic<std::atomic<uint8_t>*>[max_segs]);
+                for(uint32_t i = 0; i < max_segs; i++) {
+                    copies[c][i].store(nullptr, std::memory_order_relaxed);
+                }
+            }
+        }
+        ~SharedUnits()
+        {
+            for(const auto& segs: copies) {
+                for(uint32_t i = 0; i < max_segs; i++) {
+                    delete[] segs[i].load(std::memory_order_relaxed);
+                }
+            }
+        }
+        SharedUnits(const SharedUnits&) = delete;
+        SharedUnits& operator=(const SharedUnits&) = delete;
 
-        size_t calc_memory_use_bins()
+        lbool get(const uint32_t var, const uint32_t copy = 0) const
+        {
+            const std::atomic<uint8_t>* seg = copies[copy][var >> seg_bits].load(std::memory_order_acquire);
+            if (seg == nullptr) {
+                return l_Undef;
+            }
+            return toLbool(seg[var & seg_mask].load(std::memory_order_relaxed));
+        }
+
+        //Returns the value the variable has now. This is 'val', unless
+        //another thread has set it first
+        lbool set(const uint32_t var, const lbool val)
+        {
+            std::atomic<uint8_t>& at = get_seg(0, var >> seg_bits)[var & seg_mask];
+            uint8_t expected = toInt(l_Undef);
+            if (!at.compare_exchange_strong(expected, toInt(val), std::memory_order_relaxed)) {
+                if (toLbool(expected) != val) {
+                    clashed.store(true, std::memory_order_relaxed);
+                }
+                return toLbool(expected);
+            }
+            for(uint32_t c = 1; c < copies.size(); c++) {
+                get_seg(c, var >> seg_bits)[var & seg_mask].store(toInt(val), std::memory_order_relaxed);
+            }
+            return val;
+        }
+
+        uint32_t num_copies() const { return copies.size(); }
+
+        //Two threads set a variable to different values, so the problem is UNSAT
+        bool clash() const { return clashed.load(std::memory_order_relaxed); }
+
+        size_t mem_used() const
         {
             size_t mem = 0;
-            mem += value.capacity()*sizeof(lbool);
-            mem += bins.capacity()*sizeof(Spec);
-            for(size_t i = 0; i < bins.size(); i++) {
-                if (bins[i].data) {
-                    mem += bins[i].data->capacity()*sizeof(Lit);
-                    mem += sizeof(vector<Lit>);
+            for(const auto& segs: copies) {
+                mem += max_segs*sizeof(std::atomic<std::atomic<uint8_t>*>);
+                for(uint32_t i = 0; i < max_segs; i++) {
+                    if (segs[i].load(std::memory_order_relaxed) != nullptr) {
+                        mem += seg_size;
+                    }
                 }
             }
             return mem;
         }
+
+    private:
+        static constexpr uint32_t seg_bits = 16;
+        static constexpr uint32_t seg_size = 1U << seg_bits;
+        static constexpr uint32_t seg_mask = seg_size - 1;
+        static constexpr uint32_t max_segs = (var_Undef >> seg_bits) + 1;
+        vector<std::unique_ptr<std::atomic<std::atomic<uint8_t>*>[]>> copies;
+        vector<int> nodes; ///<Node of each copy, -1 if it's not placed
+        std::atomic<bool> clashed{false};
+
+        std::atomic<uint8_t>* get_seg(const uint32_t c, const uint32_t i)
+        {
+            std::atomic<uint8_t>* seg = copies[c][i].load(std::memory_order_acquire);
+            if (seg != nullptr) {
+                return seg;
+            }
+
+            std::atomic<uint8_t>* fresh = new std::atomic<uint8_t>[seg_size];
+            for(uint32_t j = 0; j < seg_size; j++) {
+                fresh[j].store(toInt(l_Undef), std::memory_order_relaxed);
+            }
+            numa_move({MemRange{fresh, seg_size}}, nodes[c]);
+            if (copies[c][i].compare_exchange_strong(seg, fresh, std::memory_order_acq_rel)) {
+                return fresh;
+            }
+            //Another thread was faster
+            delete[] fresh;
+            return seg;
+        }
+};
+
+/**
+@brief The binary clauses one thread shares with all the others
+
+Append-only, and only the owning thread appends, so there is no lock. Binaries
+are stored in fixed-size chunks linked one after the other, and every reader
+keeps a Cursor into it. Chunks are only freed with the log.
+*/
+class BinLog
+{
+    static constexpr uint32_t chunk_bins = 1U << 12;
+    struct Chunk {
+        Lit lits[2*chunk_bins];
+        std::atomic<Chunk*> next{nullptr};
+    };
+
+    public:
+        struct Cursor {
+            const Chunk* chunk = nullptr;
+            uint32_t at = 0; ///<Binaries read in 'chunk'
+            uint64_t num_read = 0;
+        };
+
+        BinLog() : first(new Chunk), last(first) {}
+        ~BinLog()
+        {
+            for(Chunk* c = first; c != nullptr; ) {
+                Chunk* next = c->next.load(std::memory_order_relaxed);
+                delete c;
+                c = next;
+            }
+        }
+        BinLog(const BinLog&) = delete;
+        BinLog& operator=(const BinLog&) = delete;
+
+        //Only called by the owning thread
+        void push(const Lit lit1, const Lit lit2)
+        {
+            if (last_used == chunk_bins) {
+                Chunk* c = new Chunk;
+                last->next.store(c, std::memory_order_release);
+                last = c;
+                last_used = 0;
+                num_chunks++;
+            }
+            last->lits[2*last_used] = lit1;
+            last->lits[2*last_used+1] = lit2;
+            last_used++;
+            num.store(num.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        }
+
+        //Calls f(lit1, lit2) on every binary appended since 'cur' was last used
+        template<class F> void read(Cursor& cur, F&& f) const
+        {
+            const uint64_t n = num.load(std::memory_order_acquire);
+            if (cur.chunk == nullptr) {
+                cur.chunk = first;
+            }
+            for(; cur.num_read < n; cur.num_read++, cur.at++) {
+                if (cur.at == chunk_bins) {
+                    cur.chunk = cur.chunk->next.load(std::memory_order_acquire);
+                    cur.at = 0;
+                }
+                f(cur.chunk->lits[2*cur.at], cur.chunk->lits[2*cur.at+1]);
+            }
+        }
+
+        uint64_t size() const { return num.load(std::memory_order_relaxed); }
+
+        //Only called by the owning thread
+        size_t mem_used() const { return num_chunks*sizeof(Chunk); }
+
+    private:
+        Chunk* first;
+        Chunk* last; ///<Only used by the writer
+        uint32_t last_used = 0; ///<Only used by the writer
+        size_t num_chunks = 1;
+        std::atomic<uint64_t> num{0}; ///<Binaries appended
+};
+
+/**
+@brief The rounds the threads exchange data in, with SolverConf::deterministic
+
+A thread starts a round once it has done a fixed amount of work since its last
+one, counted in propagations ("bogoprops"), not in time. In a round everyone
+first writes what it shares, and waits for all others. Then everyone reads
+what the others wrote, and waits again, so nobody writes while anybody reads.
+What a thread gets then only depends on what the threads did before the round,
+so the run is the same every time for the same seed and number of threads.
+
+A thread that has finished solving takes part in one more round, telling the
+others so. Of the threads that finished before the same round, the one with
+the lowest id wins, and everyone stops.
+*/
+class DetRounds
+{
+    public:
+        //Number of threads taking part from now on. Only called while no
+        //thread is solving
+        void start(const uint32_t _num)
+        {
+            std::lock_guard<std::mutex> lock(mu);
+            assert(arrived == 0);
+            num = _num;
+        }
+
+        //Waits until all threads got here. Returns the winner, or -1 if
+        //nobody has finished yet
+        int wait(const uint32_t tid, const bool finished)
+        {
+            std::unique_lock<std::mutex> lock(mu);
+            if (finished && (lowest_finished == -1 || (int)tid < lowest_finished)) {
+                lowest_finished = tid;
+            }
+            const uint64_t my_gen = gen;
+            if (++arrived == num) {
+                arrived = 0;
+                winner = lowest_finished;
+                lowest_finished = -1;
+                gen++;
+                cv.notify_all();
+            } else {
+                cv.wait(lock, [&]{ return gen != my_gen; });
+            }
+            //Nobody can finish the next round before we have read it
+            return winner;
+        }
+
+    private:
+        std::mutex mu;
+        std::condition_variable cv;
+        uint32_t num = 1;
+        uint32_t arrived = 0;
+        uint64_t gen = 0; ///<Times everyone got here
+        int lowest_finished = -1;
+        int winner = -1; ///<Of the last round
+};
+
+class SharedData
+{
+    public:
+        //'thread_nodes' is the NUMA node of each thread, if they are placed
+        SharedData(const uint32_t _num_threads, const vector<int>& _thread_nodes = {}) :
+            units(distinct_nodes(_thread_nodes))
+            , long_cls(_num_threads)
+            , num_threads(_num_threads)
+            , thread_nodes(_thread_nodes)
+        {
+            cur_thread_id.store(0);
+            for(uint32_t i = 0; i < num_threads; i++) {
+                bin_logs.push_back(std::make_unique<BinLog>());
+            }
+            if (units.num_copies() > 1) {
+                const vector<int> nodes = distinct_nodes(thread_nodes);
+                for(const int node: thread_nodes) {
+                    units_copy_of.push_back(std::find(nodes.begin(), nodes.end(), node) - nodes.begin());
+                }
+            }
+        }
+        ~SharedData() {}
+
+        //Node of thread 'tid', -1 if it's not placed
+        int node_of(const uint32_t tid) const
+        {
+            return tid < thread_nodes.size() ? thread_nodes[tid] : -1;
+        }
+
+        //Copy of 'units' thread 'tid' reads
+        uint32_t units_copy(const uint32_t tid) const
+        {
+            return tid < units_copy_of.size() ? units_copy_of[tid] : 0;
+        }
+
+        //None of these need a lock, see their descriptions
+        SharedUnits units;
+        vector<std::unique_ptr<BinLog>> bin_logs; ///<One per thread
+        //One per thread, set up before the threads start
+        vector<std::unique_ptr<ClauseRing>> long_cls;
+        std::atomic<int> cur_thread_id;
+        uint32_t num_threads;
+
+        //Only used with SolverConf::deterministic, it takes its own lock
+        DetRounds rounds;
+
+        //With SolverConf::shared_irred_db, the clauses in thread 0's shared
+        //region, in order of Clause::shared_at. Only changed while no thread
+        //is solving
+        vector<ClOffset> irred_cls;
+
+    private:
+        vector<int> thread_nodes;
+        vector<uint32_t> units_copy_of;
+
+        static vector<int> distinct_nodes(vector<int> nodes)
+        {
+            std::sort(nodes.begin(), nodes.end());
+            nodes.erase(std::unique(nodes.begin(), nodes.end()), nodes.end());
+            if (nodes.size() == 1) nodes.clear();
+            return nodes;
+        }
 };
 
 }
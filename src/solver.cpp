@@ -62,6 +62,7 @@ THE SOFTWARE.
 #include "gaussian.h"
 #include "sqlstats.h"
 #include "frat.h"
+#include "numa.h"
 #include "idrup.h"
 #include "xorfinder.h"
 #include "cardfinder.h"
@@ -69,7 +70,10 @@ THE SOFTWARE.
 #include "matrixfinder.h"
 #include "lucky.h"
 #include "get_clause_query.h"
+#include "comphandler.h"
+#include "rowkernels.h"
 #include "community_finder.h"
+#include "hugepages.h"
 extern "C" {
 #include "mpicosat/mpicosat.h"
 }
@@ -150,6 +154,7 @@ Solver::~Solver()
     delete breakid;
 #endif
     delete card_finder;
+    delete compHandler;
 }
 
 void Solver::set_sqlite(
@@ -378,13 +383,15 @@ Clause* Solver::add_clause_int(
             attach_bin_clause(ps[0], ps[1], red, ID);
             return nullptr;
         default:
-            Clause* c = cl_alloc.Clause_new(ps, sumConflicts, ID);
-            c->isRed = red;
+            Clause* c = cl_alloc.Clause_new(ps, sumConflicts, ID
+                , red ? ClauseAllocator::red_region(cl_stats ? cl_stats->which_red_array : 2)
+                    : ClauseAllocator::irred_region);
+            assert(c->red() == red);
             if (cl_stats) {
-                c->stats = *cl_stats;
-                STATS_DO(if (ID != c->stats.ID && sqlStats && c->stats.is_tracked)
-                        sqlStats->update_id(c->stats.ID, ID));
-                c->stats.id = ID;
+                cl_alloc.set_stats(c, *cl_stats);
+                STATS_DO(if (ID != c->id && sqlStats && c->is_tracked)
+                        sqlStats->update_id(c->id, ID));
+                c->id = ID;
             }
             if (red && cl_stats == nullptr) {
                 assert(false && "does this happen at all? should it happen??");
@@ -770,6 +777,9 @@ bool Solver::add_clause_outer(vector<Lit>& ps, const vector<Lit>& outer_ps, bool
         ClOffset offset = cl_alloc.get_offset(cl);
         if (!red) longIrredCls.push_back(offset);
         else longRedCls[2].push_back(offset);
+
+        //Huge CNFs can run out of compact offsets before the first consolidation
+        if (!restore && cl_alloc.must_widen()) cl_alloc.consolidate(this);
     }
 
     zeroLevAssignsByCNF += trail.size() - origTrailSize;
@@ -1384,6 +1394,12 @@ lbool Solver::solve_with_assumptions(
     }
     #endif
 
+    //The components of the simplified problem may be solved on their own
+    if (status == l_Undef && conf.comp_solve && nVars() > 0) {
+        if (compHandler == nullptr) compHandler = new CompHandler(this);
+        if (compHandler->solve(status)) goto end;
+    }
+
     if (status == l_Undef) status = iterate_until_solved();
 
     end:
@@ -1395,7 +1411,10 @@ lbool Solver::solve_with_assumptions(
     conf.maxTime = numeric_limits<double>::max();
     datasync->finish_up_mpi();
     conf.conf_needed = true;
-    set_must_interrupt_asap();
+    //A thread done with a cube or a query must not stop the others, see
+    //CubeConquer and BatchSolve. In the deterministic mode they are stopped
+    //at the next round, see DetRounds
+    if (!conf.cube_conquer && !conf.deterministic && !batch_worker) set_must_interrupt_asap();
     assert(decisionLevel()== 0);
     assert(!ok || prop_at_head());
     if (_assumptions == nullptr || _assumptions->empty()) {
@@ -2129,6 +2148,9 @@ void Solver::print_full_stats(
     cout << "c All times are for this thread only except if explicitly specified" << endl;
     sumSearchStats.print(sumPropStats.propagations, conf.do_print_times, conf.prefix);
     sumPropStats.print(sumSearchStats.cpu_time);
+    print_stats_line("c watch-search impl"
+        , find_non_false_name(get_find_non_false(conf.prop_simd)));
+    print_stats_line("c gauss-row impl", row_kernels.name);
     //reduceDB->get_total_time().print(cpu_time);
 
     //OccSimplifier stats
@@ -2164,6 +2186,14 @@ uint64_t Solver::print_watch_mem_used(const uint64_t rss_mem_used) const
         , "%"
     );
 
+    //The rest is free space in the slab: holes, and room for lists to grow
+    print_stats_line(conf.prefix + "Watch slab utilisation"
+        , stats_line_percent(watches.mem_used_lists(), alloc)
+        , "%"
+        , watches.num_slab_chunks()
+        , "chunks"
+    );
+
     size_t array = watches.mem_used_array();
     print_stats_line(solver->conf.prefix + "Mem for watch array"
         , array/(1024UL*1024UL)
@@ -2188,11 +2218,24 @@ uint64_t Solver::mem_used_vardata() const
 {
     uint64_t mem = 0;
     mem += assigns.capacity()*sizeof(lbool);
-    mem += varData.capacity()*sizeof(VarData);
+    mem += lit_assigns.capacity()*sizeof(lbool);
+    mem += varData.mem_used();
 
     return mem;
 }
 
+//The big pieces of memory of this thread
+vector<MemRange> Solver::mem_ranges() const
+{
+    vector<MemRange> ranges = watches.huge_ranges();
+    cl_alloc.add_ranges(ranges);
+    varData.add_ranges(ranges);
+    ranges.push_back(MemRange{assigns.data(), assigns.capacity()*sizeof(lbool)});
+    ranges.push_back(MemRange{lit_assigns.data(), lit_assigns.capacity()*sizeof(lbool)});
+    ranges.push_back(MemRange{trail.data(), trail.capacity()*sizeof(Trail)});
+    return ranges;
+}
+
 void Solver::print_mem_stats() const
 {
     double vm_mem_used = 0;
@@ -2206,6 +2249,35 @@ void Solver::print_mem_stats() const
     account += print_mem_used_longclauses(rss_mem_used);
     account += print_watch_mem_used(rss_mem_used);
 
+    if (numa_node >= 0) {
+        uint64_t remote;
+        uint64_t sampled;
+        numa_remote_pages(mem_ranges(), numa_node, remote, sampled);
+        print_stats_line(conf.prefix + "Mem on remote NUMA node"
+            , stats_line_percent(remote, sampled)
+            , "% of pages looked at"
+        );
+    }
+
+    if (conf.hugepages) {
+        //Already accounted for above, these are only the huge page-backed parts
+        print_stats_line(conf.prefix + "THP mode", thp_mode());
+        const uint64_t cl_huge = cl_alloc.mem_huge_backed();
+        print_stats_line(conf.prefix + "Mem THP-backed cls"
+            , cl_huge/(1024UL*1024UL)
+            , "MB"
+            , stats_line_percent(cl_huge, cl_alloc.mem_used())
+            , "% of clause mem"
+        );
+        const uint64_t ws_huge = watches.mem_huge_backed();
+        print_stats_line(conf.prefix + "Mem THP-backed watch"
+            , ws_huge/(1024UL*1024UL)
+            , "MB"
+            , stats_line_percent(ws_huge, watches.mem_used_alloc()+watches.mem_used_array())
+            , "% of watch mem"
+        );
+    }
+
     size_t mem = 0;
     mem += mem_used_vardata();
     print_stats_line(conf.prefix + "Mem for assings&vardata"
@@ -3287,10 +3359,10 @@ void Solver::reset_vsids()
 #ifdef STATS_NEEDED
 void Solver::stats_del_cl(Clause* cl)
 {
-    if (cl->stats.is_tracked && sqlStats) {
-        const ClauseStatsExtra& stats_extra = solver->red_stats_extra[cl->stats.extra_pos];
+    if (cl->is_tracked && sqlStats) {
+        const ClauseStatsExtra& stats_extra = solver->red_stats_extra[cl_alloc.red_stats(cl).extra_pos];
         assert(stats_extra.orig_ID != 0);
-        assert(stats_extra.orig_ID <= cl->stats.ID);
+        assert(stats_extra.orig_ID <= cl->id);
         sqlStats->cl_last_in_solver(this, stats_extra.orig_ID);
     }
 }
@@ -3482,6 +3554,7 @@ void Solver::create_from_solution_reconstruction_data(const string& data)
         ar >> nvars;
         new_vars(nvars);
         ar >> assigns;
+        rebuild_lit_assigns();
         ar >> inter_to_outerMain;
         ar >> outer_to_interMain;
         ar >> varData;
@@ -3519,7 +3592,7 @@ pair<lbool, vector<lbool>> Solver::extend_minimized_model(const vector<lbool>& m
 
     // set values from model given
     for(size_t i = 0; i < m.size(); i++) {
-        assigns[i] = m[i];
+        set_var_value(i, m[i]);
         assert(varData[i].removed == Removed::none);
     }
 
@@ -3539,6 +3612,29 @@ pair<lbool, vector<lbool>> Solver::extend_minimized_model(const vector<lbool>& m
     return make_pair(l_True, model);
 }
 
+/**
+@brief Sets the model from a model of the clauses got in simplified form
+
+'outer_model' is in OUTER numbering, and must satisfy the clauses we had when
+they were got. Variables removed since then are not taken from it: extending
+the solution sets them, just like after our own search.
+*/
+void Solver::extend_model_of_simplified(const vector<lbool>& outer_model, const bool only_sampling_solution)
+{
+    assert(okay());
+    assert(decisionLevel() == 0);
+    assert(get_num_bva_vars() == 0);
+    assert(outer_model.size() == nVarsOuter());
+
+    model.assign(nVarsOuter(), l_Undef);
+    for(uint32_t v = 0; v < nVarsOuter(); v++) {
+        if (varData[v].removed != Removed::none) continue;
+        if (value(v) != l_Undef) model[v] = value(v);
+        else model[v] = outer_model[map_inter_to_outer(v)];
+    }
+    extend_solution(only_sampling_solution);
+}
+
 // returns whether it can be removed
 bool Solver::minimize_clause(vector<Lit>& cl) {
     assert(get_num_bva_vars() == 0);
@@ -3640,14 +3736,14 @@ void Solver::detach_clauses_in_xors() {
     vector<ClOffset> delayed_clause_free;
     for(auto offs: longIrredCls) {
         Clause* cl = cl_alloc.ptr(offs);
-        cl->stats.marked_clause = false;
+        cl->marked_clause = false;
         assert(!cl->freed());
         assert(!cl->get_removed());
         if (cl->size() <= maxsize_xor &&
                 xor_hashes.count(hash_xcl(cl)) &&
                 check_clause_represented_by_xor(*cl)) {
             detachClause(*cl);
-            cl->stats.marked_clause = true;
+            cl->marked_clause = true;
             deleted++;
         }
     }
@@ -3656,7 +3752,7 @@ void Solver::detach_clauses_in_xors() {
         uint32_t j = 0;
         for(unsigned int offs : longIrredCls) {
              Clause* cl = cl_alloc.ptr(offs);
-            if (!cl->stats.marked_clause) longIrredCls[j++] = offs;
+            if (!cl->marked_clause) longIrredCls[j++] = offs;
         }
         longIrredCls.resize(j);
 
@@ -3776,8 +3872,8 @@ void Solver::dump_clauses_at_finishup_as_last()
     for(auto& red_cls: longRedCls) {
         for(auto& offs: red_cls) {
             Clause* cl = cl_alloc.ptr(offs);
-            if (cl->stats.is_tracked) {
-                ClauseStatsExtra& stats_extra = solver->red_stats_extra[cl->stats.extra_pos];
+            if (cl->is_tracked) {
+                ClauseStatsExtra& stats_extra = solver->red_stats_extra[cl_alloc.red_stats(cl).extra_pos];
                 sqlStats->cl_last_in_solver(solver, stats_extra.orig_ID);
             }
         }
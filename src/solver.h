@@ -74,6 +74,7 @@ class ReduceDB;
 class InTree;
 class BreakID;
 class GetClauseQuery;
+class CompHandler;
 
 struct SolveStats
 {
@@ -166,6 +167,8 @@ class Solver : public Searcher
         size_t get_num_vars_elimed() const;
         uint32_t num_active_vars() const;
         void print_mem_stats() const;
+        vector<MemRange> mem_ranges() const;
+        int numa_node = -1; ///<NUMA node the thread is placed on, -1 if it's not
         uint64_t print_watch_mem_used(uint64_t total_mem) const;
         const SolveStats& get_solve_stats() const;
         const SearchStats& get_stats() const;
@@ -199,6 +202,8 @@ class Solver : public Searcher
         StrImplWImpl* dist_impl_with_impl = nullptr;
         CardFinder*            card_finder = nullptr;
         GetClauseQuery*        get_clause_query = nullptr;
+        CompHandler*           compHandler = nullptr; ///<Made when first needed, it has threads
+        bool batch_worker = false; ///<Solving one query of a batch, see BatchSolve
 
         SearchStats sumSearchStats;
         PropStats sumPropStats;
@@ -212,6 +217,8 @@ class Solver : public Searcher
         string serialize_solution_reconstruction_data() const;
         void create_from_solution_reconstruction_data(const string& str);
         pair<lbool, vector<lbool>> extend_minimized_model(const vector<lbool>& m);
+        void extend_model_of_simplified(const vector<lbool>& outer_model, const bool only_sampling_solution);
+        Lit cube_split_lit(const vector<Lit>& cube);
 
         // Clauses
         bool add_xor_clause_inter(
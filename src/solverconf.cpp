@@ -169,6 +169,10 @@ DLL_PUBLIC SolverConf::SolverConf() :
         //Chono BT
         , diff_declev_for_chrono (20)
 
+        //Propagation
+        , prop_prefetch_lookahead(4)
+        , prop_simd(1)
+
         //decision-based clause generation. These values have been validated
         //see 8099966.wlm01
         , do_decision_based_cl(1)
@@ -337,6 +341,7 @@ DLL_PUBLIC SolverConf::SolverConf() :
         , doRenumberVars   (true)
         , must_renumber    (false)
         , doSaveMem        (true)
+        , hugepages        (false)
         , full_watch_consolidate_every_n_confl (4ULL*1000ULL*1000ULL) //validated in run 8113323.wlm01
 
         //Misc optimisations
@@ -359,6 +364,23 @@ DLL_PUBLIC SolverConf::SolverConf() :
 
         //Multi-thread, MPI
         , sync_every_confl(7000) //THREAD syncing
+        , share_long_cls(true)
+        , share_long_max_size(16)
+        , share_long_max_glue(3)
+        , share_long_buf_size(1U << 16)
+        , shared_irred_db(false)
+        , leader_simplify(false)
+        , cube_conquer(false)
+        , cube_confl(5000)
+        , cube_cands(50)
+        , cube_init_mult(2)
+        , pin_threads(0)
+        , numa_local_mem(true)
+        , deterministic(false)
+        , det_round_props(30ULL*1000ULL*1000ULL)
+        , comp_solve(false)
+        , comp_threads(0)
+        , comp_max_ratio(0.9)
         , every_n_mpi_sync(3) //every N thread sync, we do an MPI sync
         , thread_num(0)
         , is_mpi(false)
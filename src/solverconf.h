@@ -209,6 +209,10 @@ class GaussConf
     bool doMatrixFind = true;
     uint32_t min_gauss_xor_clauses = 2;
     uint32_t max_gauss_xor_clauses = 500000;
+
+    //Matrices with at least this many cells (rows*columns) are reduced
+    //with blocked, method of four Russians elimination at (re-)init
+    uint64_t m4ri_min_cells = 1ULL << 16;
 };
 
 class DLL_PUBLIC SolverConf
@@ -325,6 +329,10 @@ class DLL_PUBLIC SolverConf
         //chrono bt
         int diff_declev_for_chrono;
 
+        //Propagation
+        uint32_t prop_prefetch_lookahead; //0 = no clause prefetching
+        int      prop_simd; //search for new watch with AVX2/AVX-512, if the CPU has it
+
         //decision-based conflict clause generation
         int       do_decision_based_cl;
         uint32_t  decision_based_cl_max_levels;
@@ -474,6 +482,7 @@ class DLL_PUBLIC SolverConf
         int       doRenumberVars;
         int       must_renumber; ///< if set, all "renumber" is treated as a "must-renumber"
         int       doSaveMem;
+        int       hugepages; ///< back clause arena & watches with transparent huge pages
         uint64_t  full_watch_consolidate_every_n_confl;
         int must_always_conslidate = 0; // only used for debugging
 
@@ -506,6 +515,23 @@ class DLL_PUBLIC SolverConf
 
         //Multi-thread, MPI
         unsigned long long sync_every_confl;
+        int      share_long_cls; ///<Share short, low-glue learnt clauses between threads
+        uint32_t share_long_max_size;
+        uint32_t share_long_max_glue;
+        uint32_t share_long_buf_size; ///<In 32b words, per thread
+        int      shared_irred_db; ///<Threads use thread 0's long irredundant clauses in place. Turns off simplification
+        int      leader_simplify; ///<Only thread 0 simplifies at startup, the others get its simplified clauses
+        int      cube_conquer; ///<Threads solve cubes of the problem, see CubeConquer
+        uint64_t cube_confl; ///<A cube is split after this many conflicts
+        uint32_t cube_cands; ///<Lookahead looks at this many of the most active variables
+        uint32_t cube_init_mult; ///<Split into this many cubes per thread at the start
+        int      pin_threads; ///<0: the OS places threads, 1: one core each, spread over the NUMA nodes, 2: one NUMA node each
+        int      numa_local_mem; ///<Move the memory of a pinned thread to its NUMA node
+        int      deterministic; ///<Threads only exchange data in rounds, see DetRounds
+        uint64_t det_round_props; ///<Bogoprops a thread does between two rounds
+        int      comp_solve; ///<Solve the components of the simplified problem on their own, see CompHandler
+        uint32_t comp_threads; ///<Threads for the components, 0 is one per core
+        double   comp_max_ratio; ///<Not split if the largest component has more of the variables
         uint32_t every_n_mpi_sync;
         unsigned thread_num;
         uint32_t is_mpi;
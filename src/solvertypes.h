@@ -33,6 +33,7 @@ THE SOFTWARE.
 #include <cassert>
 #include "solverconf.h"
 #include "solvertypesmini.h"
+#include "watchsearch.h"
 
 namespace CMSat {
 
@@ -353,6 +354,13 @@ struct PropStats
         bogoProps += other.bogoProps;
         otfHyperTime += other.otfHyperTime;
         otfHyperPropCalled += other.otfHyperPropCalled;
+        clPrefetched += other.clPrefetched;
+        clVisited += other.clVisited;
+        for(uint32_t b = 0; b < watch_search_buckets; b++) {
+            watchSearch[b] += other.watchSearch[b];
+            watchSearchSampled[b] += other.watchSearchSampled[b];
+            watchSearchCycles[b] += other.watchSearchCycles[b];
+        }
         #ifdef STATS_NEEDED
         varSetPos += other.varSetPos;
         varSetNeg += other.varSetNeg;
@@ -368,6 +376,13 @@ struct PropStats
         bogoProps -= other.bogoProps;
         otfHyperTime -= other.otfHyperTime;
         otfHyperPropCalled -= other.otfHyperPropCalled;
+        clPrefetched -= other.clPrefetched;
+        clVisited -= other.clVisited;
+        for(uint32_t b = 0; b < watch_search_buckets; b++) {
+            watchSearch[b] -= other.watchSearch[b];
+            watchSearchSampled[b] -= other.watchSearchSampled[b];
+            watchSearchCycles[b] -= other.watchSearchCycles[b];
+        }
         #ifdef STATS_NEEDED
         varSetPos -= other.varSetPos;
         varSetNeg -= other.varSetNeg;
@@ -409,6 +424,26 @@ struct PropStats
             , "/ sec"
         );
 
+        print_stats_line("c Mcl-visited", (double)clVisited/(1000.0*1000.0)
+            , ratio_for_stat(clVisited, propagations)
+            , "/ prop"
+        );
+
+        print_stats_line("c Mcl-prefetched", (double)clPrefetched/(1000.0*1000.0)
+            , stats_line_percent(clPrefetched, clVisited)
+            , "% of visited"
+        );
+
+        for(uint32_t b = 0; b < watch_search_buckets; b++) {
+            if (watchSearch[b] == 0) continue;
+            print_stats_line(string("c watch-search sz ") + watch_search_bucket_name(b)
+                , watchSearch[b]
+                , "searches"
+                , ratio_for_stat(watchSearchCycles[b], watchSearchSampled[b])
+                , "cycles/search"
+            );
+        }
+
         #ifdef STATS_NEEDED
         print_stats_line("c varSetPos", varSetPos
             , stats_line_percent(varSetPos, propagations)
@@ -432,6 +467,15 @@ struct PropStats
     uint64_t bogoProps = 0;    ///<An approximation of time
     uint64_t otfHyperTime = 0;
     uint32_t otfHyperPropCalled = 0;
+    uint64_t clPrefetched = 0; ///<Clauses prefetched during propagation
+    uint64_t clVisited = 0;    ///<Clauses dereferenced during propagation
+
+    //New watch searches per clause size bucket, every
+    //watch_search_sample_every-th one is timed
+    static constexpr uint64_t watch_search_sample_every = 64;
+    uint64_t watchSearch[watch_search_buckets] = {};
+    uint64_t watchSearchSampled[watch_search_buckets] = {};
+    uint64_t watchSearchCycles[watch_search_buckets] = {};
 
     #ifdef STATS_NEEDED
     uint64_t varSetPos = 0;
@@ -780,7 +780,8 @@ void SQLiteStats::reduceDB(
     , const Clause* cl
     , const uint32_t reduceDB_called
 ) {
-    const ClauseStatsExtra& stats_extra = solver->red_stats_extra[cl->stats.extra_pos];
+    const RedClauseStats& red_stats = solver->cl_alloc.red_stats(cl);
+    const ClauseStatsExtra& stats_extra = solver->red_stats_extra[red_stats.extra_pos];
     assert(stats_extra.dump_no != numeric_limits<uint16_t>::max());
 
     int bindAt = 1;
@@ -791,32 +792,32 @@ void SQLiteStats::reduceDB(
     sqlite3_bind_int(stmtReduceDB, bindAt++, reduceDB_called);
     sqlite3_bind_int64(stmtReduceDB, bindAt++, solver->sumConflicts);
     sqlite3_bind_int64(stmtReduceDB, bindAt++, stats_extra.introduced_at_conflict);
-    sqlite3_bind_int(stmtReduceDB, bindAt++, cl->stats.which_red_array);
+    sqlite3_bind_int(stmtReduceDB, bindAt++, red_stats.which_red_array);
 
     //data
     sqlite3_bind_int64(stmtReduceDB, bindAt++, stats_extra.orig_ID);
     sqlite3_bind_int64(stmtReduceDB, bindAt++, stats_extra.dump_no);
     sqlite3_bind_int64(stmtReduceDB, bindAt++, stats_extra.conflicts_made);
-    sqlite3_bind_int64(stmtReduceDB, bindAt++, cl->stats.props_made);
+    sqlite3_bind_int64(stmtReduceDB, bindAt++, red_stats.props_made);
     sqlite3_bind_int64(stmtReduceDB, bindAt++, stats_extra.sum_props_made);
-    sqlite3_bind_int64(stmtReduceDB, bindAt++, cl->stats.uip1_used);
+    sqlite3_bind_int64(stmtReduceDB, bindAt++, red_stats.uip1_used);
     sqlite3_bind_int64(stmtReduceDB, bindAt++, stats_extra.sum_uip1_used);
 
-    assert(cl->stats.last_touched_any <= solver->sumConflicts);
-    int64_t last_touched_any_diff = solver->sumConflicts - cl->stats.last_touched_any;
+    assert(red_stats.last_touched_any <= solver->sumConflicts);
+    int64_t last_touched_any_diff = solver->sumConflicts - red_stats.last_touched_any;
     sqlite3_bind_int64(stmtReduceDB, bindAt++, last_touched_any_diff);
-    sqlite3_bind_double(stmtReduceDB, bindAt++, (double)cl->stats.activity/(double)solver->get_cla_inc());
+    sqlite3_bind_double(stmtReduceDB, bindAt++, (double)red_stats.activity/(double)solver->get_cla_inc());
     sqlite3_bind_int(stmtReduceDB, bindAt++, locked);
     sqlite3_bind_int(stmtReduceDB, bindAt++, false); // used in XOR -- nope
-    if (cl->stats.is_ternary_resolvent) {
+    if (cl->is_ternary_resolvent) {
         sqlite3_bind_null(stmtReduceDB, bindAt++);
     } else {
-        sqlite3_bind_int(stmtReduceDB, bindAt++, cl->stats.glue);
+        sqlite3_bind_int(stmtReduceDB, bindAt++, red_stats.glue);
     }
     sqlite3_bind_int(stmtReduceDB, bindAt++, cl->size());
     sqlite3_bind_int(stmtReduceDB, bindAt++, stats_extra.ttl_stats);
-    sqlite3_bind_int(stmtReduceDB, bindAt++, cl->stats.is_ternary_resolvent);
-    sqlite3_bind_int(stmtReduceDB, bindAt++, cl->stats.is_decision);
+    sqlite3_bind_int(stmtReduceDB, bindAt++, cl->is_ternary_resolvent);
+    sqlite3_bind_int(stmtReduceDB, bindAt++, red_stats.is_decision);
     sqlite3_bind_int(stmtReduceDB, bindAt++, cl->distilled);
     sqlite3_bind_int(stmtReduceDB, bindAt++, stats_extra.connects_num_communities);
 
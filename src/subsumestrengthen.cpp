@@ -58,7 +58,7 @@ Sub0Ret SubsumeStrengthen::backw_sub_with_long(const ClOffset offset)
     //If irred is subsumed by redundant, make the redundant into irred
     if (cl.red() && ret.subsumedIrred) {
         STATS_DO(solver->stats_del_cl(&cl));
-        cl.make_irred();
+        solver->cl_alloc.make_irred(&cl);
         solver->litStats.redLits -= cl.size();
         solver->litStats.irredLits += cl.size();
         if (!cl.get_occur_linked()) {
@@ -73,10 +73,11 @@ Sub0Ret SubsumeStrengthen::backw_sub_with_long(const ClOffset offset)
     }
 
     //Update stats
-    cl.stats = ClauseStats::combineStats(cl.stats, ret.stats);
+    solver->cl_alloc.set_stats(&cl,
+        ClauseStats::combineStats(solver->cl_alloc.get_stats(&cl), ret.stats));
     #if defined(STATS_NEEDED) || defined (FINAL_PREDICTOR)
     if (cl.red()) {
-        auto& extra_stats = solver->red_stats_extra[cl.stats.extra_pos];
+        auto& extra_stats = solver->red_stats_extra[solver->cl_alloc.red_stats(&cl).extra_pos];
         extra_stats = ClauseStatsExtra::combineStats(extra_stats, ret.stats_extra);
     }
     #endif
@@ -114,11 +115,11 @@ Sub0Ret SubsumeStrengthen::subsume_and_unlink(
         //-> ID kept will be 1st parameter
         //Stats will be merged together here then merged into the
         //subsuming clause's stats
-        ret.stats = ClauseStats::combineStats(tmpcl->stats, ret.stats);
+        ret.stats = ClauseStats::combineStats(solver->cl_alloc.get_stats(tmpcl), ret.stats);
         #if defined(STATS_NEEDED) || defined(FINAL_PREDICTOR)
         if (tmpcl->red()) {
             ret.stats_extra = ClauseStatsExtra::combineStats(
-                solver->red_stats_extra[tmpcl->stats.extra_pos],
+                solver->red_stats_extra[solver->cl_alloc.red_stats(tmpcl).extra_pos],
                 ret.stats_extra);
         }
         #endif
@@ -173,7 +174,7 @@ bool SubsumeStrengthen::backw_sub_str_with_long(
                 && !cl2.red()
             ) {
                 STATS_DO(solver->stats_del_cl(&cl));
-                cl.make_irred();
+                solver->cl_alloc.make_irred(&cl);
                 solver->litStats.redLits -= cl.size();
                 solver->litStats.irredLits += cl.size();
                 if (!cl.get_occur_linked()) {
@@ -186,11 +187,12 @@ bool SubsumeStrengthen::backw_sub_str_with_long(
             }
 
             //Update stats
-            cl.stats = ClauseStats::combineStats(cl.stats, cl2.stats);
+            solver->cl_alloc.set_stats(&cl, ClauseStats::combineStats(
+                solver->cl_alloc.get_stats(&cl), solver->cl_alloc.get_stats(&cl2)));
             #if defined(STATS_NEEDED) || defined (FINAL_PREDICTOR)
             if (cl.red() && cl2.red()) {
-                auto& extra_stats = solver->red_stats_extra[cl.stats.extra_pos];
-                auto& extra_stats2 = solver->red_stats_extra[cl2.stats.extra_pos];
+                auto& extra_stats = solver->red_stats_extra[solver->cl_alloc.red_stats(&cl).extra_pos];
+                auto& extra_stats2 = solver->red_stats_extra[solver->cl_alloc.red_stats(&cl2).extra_pos];
                 extra_stats = ClauseStatsExtra::combineStats(extra_stats, extra_stats2);
             }
             #endif
@@ -464,7 +466,7 @@ bool SubsumeStrengthen::handle_added_long_cl(const bool verbose)
         const ClOffset offs = simplifier->added_long_cl[i];
         Clause* cl = solver->cl_alloc.ptr(offs);
         if (cl->freed() || cl->get_removed()) continue;
-        cl->stats.marked_clause = 0;
+        cl->marked_clause = 0;
         if (!backw_sub_str_with_long(offs, stat)) goto end;
         if ((i&0xfff) == 0xfff && solver->must_interrupt_asap()) goto end;
     }
@@ -475,7 +477,7 @@ bool SubsumeStrengthen::handle_added_long_cl(const bool verbose)
         ClOffset off = simplifier->added_long_cl[i];
         Clause* cl = solver->cl_alloc.ptr(off);
         if (cl->freed() || cl->get_removed()) continue;
-        cl->stats.marked_clause = 0;
+        cl->marked_clause = 0;
     }
     simplifier->added_long_cl.clear();
 
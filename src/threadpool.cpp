@@ -0,0 +1,101 @@
+/*************************************************************
+CryptoMiniSat --- Copyright (C) 2009-2020 Authors of CryptoMiniSat, see AUTHORS file
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+***************************************************************/
+
+
+#include "threadpool.h"
+
+#include <algorithm>
+#include <cassert>
+
+using namespace CMSat;
+
+ThreadPool::~ThreadPool()
+{
+    shrink(0);
+}
+
+void ThreadPool::run(const size_t num, const std::function<void(size_t)>& job)
+{
+    if (num == 0) return;
+
+    {
+        std::unique_lock<std::mutex> lock(mu);
+        assert(cur_job == nullptr && "Jobs can't be run in parallel");
+        keep = std::max(keep, num-1);
+        while (workers.size() < num-1) {
+            const size_t id = workers.size();
+            workers.push_back(std::thread(&ThreadPool::work, this, id));
+        }
+        cur_job = &job;
+        cur_num = num;
+        running = num-1;
+        generation++;
+    }
+    start_cv.notify_all();
+
+    job(0);
+
+    std::unique_lock<std::mutex> lock(mu);
+    done_cv.wait(lock, [&]{ return running == 0; });
+    cur_job = nullptr;
+}
+
+void ThreadPool::shrink(const size_t num)
+{
+    if (num >= workers.size()) return;
+
+    {
+        std::lock_guard<std::mutex> lock(mu);
+        assert(cur_job == nullptr);
+        keep = num;
+    }
+    start_cv.notify_all();
+    for(size_t i = num; i < workers.size(); i++) {
+        workers[i].join();
+    }
+    workers.resize(num);
+}
+
+//Thread 'id' does part id+1 of every job that has that many parts
+void ThreadPool::work(const size_t id)
+{
+    uint64_t seen_generation = 0;
+    while(true) {
+        const std::function<void(size_t)>* job;
+        {
+            std::unique_lock<std::mutex> lock(mu);
+            start_cv.wait(lock, [&]{
+                return id >= keep || generation != seen_generation;
+            });
+            if (id >= keep) return;
+            seen_generation = generation;
+            if (id+1 >= cur_num) continue;
+            job = cur_job;
+        }
+
+        (*job)(id+1);
+
+        std::lock_guard<std::mutex> lock(mu);
+        running--;
+        if (running == 0) done_cv.notify_one();
+    }
+}
@@ -0,0 +1,79 @@
+/*************************************************************
+CryptoMiniSat --- Copyright (C) 2009-2020 Authors of CryptoMiniSat, see AUTHORS file
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+***************************************************************/
+
+
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace CMSat {
+
+/**
+@brief Threads that are kept between calls, so they are only created once
+
+run() hands the same job to a number of threads and waits for all of them.
+The calling thread does part 0 of the job itself. Threads not needed by a job
+sleep on a condition variable until the next one.
+*/
+class ThreadPool
+{
+    public:
+        ThreadPool() = default;
+        ~ThreadPool();
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        //Calls job(0), ..., job(num-1), each on its own thread, and returns
+        //once all of them have returned
+        void run(const size_t num, const std::function<void(size_t)>& job);
+
+        //Stops the threads beyond the first 'num'
+        void shrink(const size_t num);
+
+        size_t size() const { return workers.size(); }
+
+    private:
+        void work(const size_t id);
+
+        std::vector<std::thread> workers;
+        std::mutex mu;
+        std::condition_variable start_cv;
+        std::condition_variable done_cv;
+
+        //Guarded by 'mu'
+        const std::function<void(size_t)>* cur_job = nullptr;
+        size_t cur_num = 0; ///<Number of parts of the current job
+        uint64_t generation = 0; ///<Incremented for every job
+        size_t running = 0; ///<Threads still working on the current job
+        size_t keep = 0; ///<Threads with a higher id must stop
+};
+
+}
+
+#endif //THREADPOOL_H
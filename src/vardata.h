@@ -23,102 +23,328 @@ THE SOFTWARE.
 #pragma once
 
 #include <limits>
+#include <vector>
+#include <type_traits>
 #include "propby.h"
 #include "avgcalc.h"
+#include "varupdatehelper.h"
+#include "hugepages.h"
 
 using std::numeric_limits;
+using std::vector;
 
 namespace CMSat
 {
 
-struct VarData
-{
-    VarData([[maybe_unused]] uint32_t num) {
-        is_bva = 0;
-        occ_simp_tried = 0;
-        saved_polarity = false;
-        stable_polarity = false;
-        best_polarity = false;
-        inv_polarity = false;
-    }
+// Per-variable data is stored as a struct-of-arrays in VarDataArray, split by
+// how often it's touched:
+//  - VarHot: level/sublevel/reason. Written at every enqueue, read in
+//    conflict analysis
+//  - one byte of flags (polarities, etc.) per variable
+//  - VarCold: everything else
+// varData[v] returns a VarDataRef that has the same members as VarData, so
+// varData[v].level, varData[v].stable_polarity = x, etc. work as before.
+// VarData is the by-value form of all the data of one variable.
 
+struct VarHot
+{
     ///contains the decision level at which the assignment was made.
     uint32_t level = numeric_limits<uint32_t>::max();
     uint32_t sublevel = numeric_limits<uint32_t>::max();
 
-
     //Reason this got propagated. nullptr means decision/toplevel
     PropBy reason = PropBy();
 
-    lbool assumption = l_Undef;
+    template<class Archive>
+    void serialize(Archive& ar, const unsigned int /*version*/) {
+        ar & level & sublevel & reason;
+    }
+};
+
+//X(type, name, default value) of every cold field
+#define VARDATA_COLD_BASE_FIELDS(X) \
+    X(lbool, assumption, l_Undef) \
+    /*Whether var has been eliminated (var-elim, different component, etc.)*/ \
+    X(Removed, removed, Removed::none) \
+    X(float, weight, 0.5)
+
+#if defined(STATS_NEEDED)
+#define VARDATA_COLD_STATS_FIELDS(X) \
+    X(uint32_t, community_num, numeric_limits<uint32_t>::max())
+#else
+#define VARDATA_COLD_STATS_FIELDS(X)
+#endif
+
+#if defined(STATS_NEEDED_BRANCH) || defined(FINAL_PREDICTOR_BRANCH)
+#define VARDATA_COLD_BRANCH_FIELDS(X) \
+    X(uint32_t, set, 0) \
+    X(uint64_t, num_propagated, 0) \
+    X(uint64_t, num_propagated_pos, 0) \
+    X(uint64_t, num_decided, 0) \
+    X(uint64_t, num_decided_pos, 0) \
+    X(bool,     last_time_set_was_dec, false) \
+    X(uint32_t, last_seen_in_1uip, 0) \
+    X(uint32_t, last_decided_on, 0) \
+    X(uint32_t, last_propagated, 0) \
+    X(uint32_t, last_canceled, 0) \
+    /*these are per-solver data*/ \
+    X(uint64_t, sumDecisions_at_picktime, 0) \
+    X(uint64_t, sumConflicts_at_picktime, 0) \
+    X(uint64_t, sumPropagations_at_picktime, 0) \
+    X(uint64_t, sumAntecedents_at_picktime, 0) \
+    X(uint64_t, sumAntecedentsLits_at_picktime, 0) \
+    X(uint64_t, sumConflictClauseLits_at_picktime, 0) \
+    X(uint64_t, sumDecisionBasedCl_at_picktime, 0) \
+    X(uint64_t, sumClLBD_at_picktime, 0) \
+    X(uint64_t, sumClSize_at_picktime, 0) \
+    X(uint64_t, sumDecisions_below_during, 0) \
+    X(uint64_t, sumConflicts_below_during, 0) \
+    X(uint64_t, sumPropagations_below_during, 0) \
+    X(uint64_t, sumAntecedents_below_during, 0) \
+    X(uint64_t, sumAntecedentsLits_below_during, 0) \
+    X(uint64_t, sumConflictClauseLits_below_during, 0) \
+    X(uint64_t, sumDecisionBasedCl_below_during, 0) \
+    X(uint64_t, sumClLBD_below_during, 0) \
+    X(uint64_t, sumClSize_below_during, 0) \
+    /*these are per-variable data*/ \
+    X(uint64_t, inside_conflict_clause, 0) \
+    X(uint64_t, inside_conflict_clause_glue, 0) \
+    X(uint64_t, inside_conflict_clause_antecedents, 0) \
+    X(uint64_t, inside_conflict_clause_at_picktime, 0) \
+    X(uint64_t, inside_conflict_clause_glue_at_picktime, 0) \
+    X(uint64_t, inside_conflict_clause_antecedents_at_picktime, 0) \
+    X(uint64_t, inside_conflict_clause_during, 0) \
+    X(uint64_t, inside_conflict_clause_glue_during, 0) \
+    X(uint64_t, inside_conflict_clause_antecedents_during, 0) \
+    X(uint64_t, last_flipped, 0) \
+    X(bool,     dump, false)
+#else
+#define VARDATA_COLD_BRANCH_FIELDS(X)
+#endif
+
+#define VARDATA_COLD_FIELDS(X) \
+    VARDATA_COLD_BASE_FIELDS(X) \
+    VARDATA_COLD_STATS_FIELDS(X) \
+    VARDATA_COLD_BRANCH_FIELDS(X)
+
+struct VarCold
+{
+    #define VARDATA_X(type, name, init) type name = init;
+    VARDATA_COLD_FIELDS(VARDATA_X)
+    #undef VARDATA_X
+
+    template<class Archive>
+    void serialize(Archive& ar, const unsigned int /*version*/) {
+        #define VARDATA_X(type, name, init) ar & name;
+        VARDATA_COLD_FIELDS(VARDATA_X)
+        #undef VARDATA_X
+    }
+};
+
+//Bits of the per-variable flag byte
+enum VarFlagBit : uint8_t {
+    stable_polarity_bit = 0,
+    saved_polarity_bit,
+    best_polarity_bit,
+    inv_polarity_bit,
+    is_bva_bit,
+    occ_simp_tried_bit,
+    propagated_bit
+};
 
-    ///Whether var has been eliminated (var-elim, different component, etc.)
-    Removed removed = Removed::none;
+struct VarData : public VarHot, public VarCold
+{
+    VarData([[maybe_unused]] uint32_t num) {}
 
     ///The preferred polarity of each variable.
-    uint8_t stable_polarity:1;
-    uint8_t saved_polarity:1;
-    uint8_t best_polarity:1;
-    uint8_t inv_polarity:1;
-    uint8_t is_bva:1;
-    uint8_t occ_simp_tried:1;
+    uint8_t stable_polarity:1 = false;
+    uint8_t saved_polarity:1 = false;
+    uint8_t best_polarity:1 = false;
+    uint8_t inv_polarity:1 = false;
+    uint8_t is_bva:1 = false;
+    uint8_t occ_simp_tried:1 = false;
     uint8_t propagated:1 = false;
 
-    float weight = 0.5;
-
-    #if defined(STATS_NEEDED)
-    uint32_t community_num = numeric_limits<uint32_t>::max();
-    #endif
-
-    #if defined(STATS_NEEDED_BRANCH) || defined(FINAL_PREDICTOR_BRANCH)
-    uint32_t set = 0;
-    uint64_t num_propagated = 0;
-    uint64_t num_propagated_pos = 0;
-    uint64_t num_decided = 0;
-    uint64_t num_decided_pos = 0;
-    bool     last_time_set_was_dec;
-    uint32_t last_seen_in_1uip = 0;
-    uint32_t last_decided_on = 0;
-    uint32_t last_propagated = 0;
-    uint32_t last_canceled = 0;
-
-    //these are per-solver data
-    uint64_t sumDecisions_at_picktime = 0;
-    uint64_t sumConflicts_at_picktime = 0;
-    uint64_t sumPropagations_at_picktime = 0;
-    uint64_t sumAntecedents_at_picktime = 0;
-    uint64_t sumAntecedentsLits_at_picktime = 0;
-    uint64_t sumConflictClauseLits_at_picktime = 0;
-    uint64_t sumDecisionBasedCl_at_picktime = 0;
-    uint64_t sumClLBD_at_picktime = 0;
-    uint64_t sumClSize_at_picktime = 0;
-
-    uint64_t sumDecisions_below_during = 0;
-    uint64_t sumConflicts_below_during = 0;
-    uint64_t sumPropagations_below_during = 0;
-    uint64_t sumAntecedents_below_during = 0;
-    uint64_t sumAntecedentsLits_below_during = 0;
-    uint64_t sumConflictClauseLits_below_during = 0;
-    uint64_t sumDecisionBasedCl_below_during = 0;
-    uint64_t sumClLBD_below_during = 0;
-    uint64_t sumClSize_below_during = 0;
-
-    //these are per-variable data
-    uint64_t inside_conflict_clause = 0;
-    uint64_t inside_conflict_clause_glue = 0;
-    uint64_t inside_conflict_clause_antecedents = 0;
-
-    uint64_t inside_conflict_clause_at_picktime = 0;
-    uint64_t inside_conflict_clause_glue_at_picktime = 0;
-    uint64_t inside_conflict_clause_antecedents_at_picktime = 0;
-
-    uint64_t inside_conflict_clause_during = 0;
-    uint64_t inside_conflict_clause_glue_during = 0;
-    uint64_t inside_conflict_clause_antecedents_during = 0;
-
-    uint64_t last_flipped = 0;
-    bool dump;
-    #endif
+    uint8_t flag_bits() const
+    {
+        return (stable_polarity << stable_polarity_bit)
+            | (saved_polarity << saved_polarity_bit)
+            | (best_polarity << best_polarity_bit)
+            | (inv_polarity << inv_polarity_bit)
+            | (is_bva << is_bva_bit)
+            | (occ_simp_tried << occ_simp_tried_bit)
+            | (propagated << propagated_bit);
+    }
 };
 
+//Reference to one bit of a variable's flag byte, behaves like a bool member
+template<class Byte>
+class VarFlagRef
+{
+public:
+    VarFlagRef(Byte& _b, const VarFlagBit bit) : b(_b), mask(1U << bit) {}
+    operator bool() const { return b & mask; }
+    VarFlagRef& operator=(const bool val)
+    {
+        if (val) b |= mask;
+        else b &= ~mask;
+        return *this;
+    }
+    VarFlagRef& operator=(const VarFlagRef& other)
+    {
+        return *this = (bool)other;
+    }
+
+private:
+    Byte& b;
+    const uint8_t mask;
+};
+
+template<bool is_const>
+struct VarDataRefT
+{
+    template<class T> using R = std::conditional_t<is_const, const T, T>;
+
+    VarDataRefT(R<VarHot>& h, R<uint8_t>& f, R<VarCold>& c) :
+        level(h.level)
+        , sublevel(h.sublevel)
+        , reason(h.reason)
+        , stable_polarity(f, stable_polarity_bit)
+        , saved_polarity(f, saved_polarity_bit)
+        , best_polarity(f, best_polarity_bit)
+        , inv_polarity(f, inv_polarity_bit)
+        , is_bva(f, is_bva_bit)
+        , occ_simp_tried(f, occ_simp_tried_bit)
+        , propagated(f, propagated_bit)
+        #define VARDATA_X(type, name, init) , name(c.name)
+        VARDATA_COLD_FIELDS(VARDATA_X)
+        #undef VARDATA_X
+        , hot_data(h)
+        , cold_data(c)
+    {}
+
+    operator VarData() const
+    {
+        VarData ret(0);
+        static_cast<VarHot&>(ret) = hot_data;
+        static_cast<VarCold&>(ret) = cold_data;
+        ret.stable_polarity = stable_polarity;
+        ret.saved_polarity = saved_polarity;
+        ret.best_polarity = best_polarity;
+        ret.inv_polarity = inv_polarity;
+        ret.is_bva = is_bva;
+        ret.occ_simp_tried = occ_simp_tried;
+        ret.propagated = propagated;
+        return ret;
+    }
+
+    R<uint32_t>& level;
+    R<uint32_t>& sublevel;
+    R<PropBy>& reason;
+
+    VarFlagRef<R<uint8_t>> stable_polarity;
+    VarFlagRef<R<uint8_t>> saved_polarity;
+    VarFlagRef<R<uint8_t>> best_polarity;
+    VarFlagRef<R<uint8_t>> inv_polarity;
+    VarFlagRef<R<uint8_t>> is_bva;
+    VarFlagRef<R<uint8_t>> occ_simp_tried;
+    VarFlagRef<R<uint8_t>> propagated;
+
+    #define VARDATA_X(type, name, init) R<type>& name;
+    VARDATA_COLD_FIELDS(VARDATA_X)
+    #undef VARDATA_X
+
+private:
+    R<VarHot>& hot_data;
+    R<VarCold>& cold_data;
+};
+typedef VarDataRefT<false> VarDataRef;
+typedef VarDataRefT<true> ConstVarDataRef;
+
+class VarDataArray
+{
+public:
+    template<bool is_const>
+    class Iterator
+    {
+    public:
+        using Arr = std::conditional_t<is_const, const VarDataArray, VarDataArray>;
+        Iterator(Arr* _arr, size_t _at) : arr(_arr), at(_at) {}
+        VarDataRefT<is_const> operator*() const { return (*arr)[at]; }
+        Iterator& operator++() { at++; return *this; }
+        bool operator==(const Iterator& other) const { return at == other.at; }
+        bool operator!=(const Iterator& other) const { return at != other.at; }
+
+    private:
+        Arr* arr;
+        size_t at;
+    };
+
+    VarDataRef operator[](const size_t v)
+    {
+        return VarDataRef(hot[v], flags[v], cold[v]);
+    }
+    ConstVarDataRef operator[](const size_t v) const
+    {
+        return ConstVarDataRef(hot[v], flags[v], cold[v]);
+    }
+    Iterator<false> begin() { return Iterator<false>(this, 0); }
+    Iterator<false> end() { return Iterator<false>(this, size()); }
+    Iterator<true> begin() const { return Iterator<true>(this, 0); }
+    Iterator<true> end() const { return Iterator<true>(this, size()); }
+
+    size_t size() const { return hot.size(); }
+    bool empty() const { return hot.empty(); }
+
+    void push_back(const VarData& d)
+    {
+        hot.push_back(d);
+        flags.push_back(d.flag_bits());
+        cold.push_back(d);
+    }
+
+    void swap_vars(const uint32_t a, const uint32_t b)
+    {
+        std::swap(hot[a], hot[b]);
+        std::swap(flags[a], flags[b]);
+        std::swap(cold[a], cold[b]);
+    }
+
+    void update(const vector<uint32_t>& mapper)
+    {
+        updateArray(hot, mapper);
+        updateArray(flags, mapper);
+        updateArray(cold, mapper);
+    }
+
+    uint64_t mem_used() const
+    {
+        return hot.capacity()*sizeof(VarHot)
+            + flags.capacity()*sizeof(uint8_t)
+            + cold.capacity()*sizeof(VarCold);
+    }
+
+    void add_ranges(vector<MemRange>& ranges) const
+    {
+        ranges.push_back(MemRange{hot.data(), hot.capacity()*sizeof(VarHot)});
+        ranges.push_back(MemRange{flags.data(), flags.capacity()*sizeof(uint8_t)});
+        ranges.push_back(MemRange{cold.data(), cold.capacity()*sizeof(VarCold)});
+    }
+
+    template<class Archive>
+    void serialize(Archive& ar, const unsigned int /*version*/) {
+        ar & hot & flags & cold;
+    }
+
+private:
+    vector<VarHot> hot;
+    vector<uint8_t> flags;
+    vector<VarCold> cold;
+};
+
+inline void updateArray(VarDataArray& toUpdate, const vector<uint32_t>& mapper)
+{
+    toUpdate.update(mapper);
+}
+
 }
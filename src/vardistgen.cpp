@@ -74,7 +74,7 @@ void VarDistGen::calc()
                 data[l.var()].red.tot_num_lit_of_long_cls_it_appears_in+=cl->size();
                 if (std::log2(solver->max_cl_act+10e-300) != 0) {
                     data[l.var()].tot_act_long_red_cls +=
-                        std::log2((double)cl->stats.activity+10e-300)
+                        std::log2((double)solver->cl_alloc.red_stats(cl).activity+10e-300)
                             /std::log2(solver->max_cl_act+10e-300);
                 }
 
@@ -696,14 +696,14 @@ bool VarReplacer::handleUpdatedClause(
     runStats.bogoprops += 3;
     switch(c.size()) {
     case 0:
-        set_unsat_cl_id(c.stats.id);
+        set_unsat_cl_id(c.id);
         solver->ok = false;
         return true;
     case 1 :
         c.set_removed();
         solver->watches.smudge(origLit1);
         solver->watches.smudge(origLit2);
-        delayedEnqueue.push_back(make_tuple(c[0], c.stats.id));
+        delayedEnqueue.push_back(make_tuple(c[0], c.id));
         runStats.removedLongLits += origSize;
         return true;
     case 2:
@@ -711,7 +711,7 @@ bool VarReplacer::handleUpdatedClause(
         solver->watches.smudge(origLit1);
         solver->watches.smudge(origLit2);
 
-        solver->attach_bin_clause(c[0], c[1], c.red(), c.stats.id);
+        solver->attach_bin_clause(c[0], c[1], c.red(), c.id);
         runStats.removedLongLits += origSize;
         return true;
 
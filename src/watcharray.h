@@ -26,19 +26,33 @@ THE SOFTWARE.
 
 #include "watched.h"
 #include "Vec.h"
+#include "watchslab.h"
+#include "hugepages.h"
 #include <cstdint>
 #include <vector>
+#include <algorithm>
 
 namespace CMSat {
 using std::vector;
 
-using watch_subarray = vec<Watched> &;
-using watch_subarray_const = const vec<Watched> &;
+using watch_subarray = watch_list &;
+using watch_subarray_const = const watch_list &;
 
 class watch_array
 {
+private:
+    //Holds the elements of all the lists, so it must outlive them
+    WatchSlab slab;
+
+    void init_lists(const size_t from)
+    {
+        for(size_t i = from; i < watches.size(); i++) {
+            watches[i].data = slab.empty_list_data();
+        }
+    }
+
 public:
-    vec<vec<Watched> > watches;
+    vec<watch_list> watches;
     vector<Lit> smudged_list;
     vector<char> smudged;
 
@@ -89,7 +103,9 @@ public:
     {
         assert(smudged_list.empty());
         if (watches.size() < new_size) {
+            const size_t old_size = watches.size();
             watches.growTo(new_size);
+            init_lists(old_size);
         } else {
             watches.shrink(watches.size()-new_size);
         }
@@ -99,16 +115,15 @@ public:
     void insert(uint32_t num)
     {
         smudged.insert(smudged.end(), num, false);
+        const size_t old_size = watches.size();
         watches.insert(num);
+        init_lists(old_size);
     }
 
     size_t mem_used() const
     {
-        double mem = watches.capacity()*sizeof(vec<Watched>);
-        for(size_t i = 0; i < watches.size(); i++) {
-            //1.2 is overhead
-            mem += (double)watches[i].capacity()*(double)sizeof(Watched)*1.2;
-        }
+        size_t mem = watches.capacity()*sizeof(watch_list);
+        mem += slab.mem_used();
         mem += smudged.capacity()*sizeof(char);
         mem += smudged_list.capacity()*sizeof(Lit);
         return mem;
@@ -123,8 +138,8 @@ public:
     {
         cmsat_prefetch(watches[at].data);
     }
-    typedef vec<Watched>* iterator;
-    typedef const vec<Watched>* const_iterator;
+    typedef watch_list* iterator;
+    typedef const watch_list* const_iterator;
 
     iterator begin()
     {
@@ -146,20 +161,43 @@ public:
         return watches.end();
     }
 
+    // Lays out the lists again in literal order, leaving some space after
+    // each to grow into, but only if much of the slab is unused
     void consolidate()
     {
-        /*for(auto& ws: watches) {
-            ws.shrink_to_fit();
-        }*/
+        if (mem_used_lists() < slab.mem_used()/2) {
+            slab.compact(watches.begin(), watches.end(), true);
+        }
         watches.shrink_to_fit();
     }
 
+    // Lays out the lists again in literal order, without any free space
     void full_consolidate()
+    {
+        slab.compact(watches.begin(), watches.end(), false);
+        watches.shrink_to_fit();
+    }
+
+    // Binary clauses are put in front of every watchlist, in their original
+    // order. Propagation goes through this prefix before the long clauses.
+    void bins_to_front()
     {
         for(auto& ws: watches) {
-            ws.shrink_to_fit();
+            std::stable_partition(ws.begin(), ws.end(),
+                [](const Watched& w) { return w.isBin(); });
         }
-        watches.shrink_to_fit();
+    }
+
+    // Slab chunks allocated before huge pages were switched on, and the
+    // array of lists, are malloc()-ed. The heap pieces they live in are advised
+    void advise_hugepages() const
+    {
+        advise_huge(huge_ranges());
+    }
+
+    uint64_t mem_huge_backed() const
+    {
+        return huge_backed_bytes(huge_ranges());
     }
 
     void print_stat()
@@ -167,22 +205,52 @@ public:
     }
 
     size_t mem_used_alloc() const
+    {
+        return slab.mem_used();
+    }
+
+    // What the lists actually hold, the rest of the slab is free space
+    size_t mem_used_lists() const
     {
         size_t mem = 0;
         for(auto& ws: watches) {
-            mem += ws.capacity()*sizeof(Watched);
+            mem += ws.size()*sizeof(Watched);
         }
 
         return mem;
     }
 
+    size_t num_slab_chunks() const
+    {
+        return slab.num_chunks();
+    }
+
+    void set_hugepages(const bool huge)
+    {
+        slab.set_hugepages(huge);
+    }
+
     size_t mem_used_array() const
     {
         size_t mem = 0;
-        mem += watches.capacity()*sizeof(vector<Watched>);
+        mem += watches.capacity()*sizeof(watch_list);
         mem += sizeof(watch_array);
         return mem;
     }
+
+    //Where the lists and the array of them are, sorted by start
+    vector<MemRange> huge_ranges() const
+    {
+        vector<MemRange> ranges;
+        if (watches.capacity() > 0) {
+            ranges.push_back(MemRange{watches.begin(), watches.capacity()*sizeof(watch_list)});
+        }
+        slab.add_ranges(ranges);
+        std::sort(ranges.begin(), ranges.end(), [](const MemRange& a, const MemRange& b) {
+            return a.start < b.start;
+        });
+        return ranges;
+    }
 };
 
 inline void swap(watch_subarray a, watch_subarray b)
@@ -0,0 +1,137 @@
+/*************************************************************
+CryptoMiniSat --- Copyright (C) 2009-2020 Authors of CryptoMiniSat, see AUTHORS file
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+***************************************************************/
+
+
+#include "watchsearch.h"
+#include "cpufeatures.h"
+
+#ifdef CMS_X86_DISPATCH
+#include <immintrin.h>
+#endif
+
+using namespace CMSat;
+
+static inline bool not_false(const Lit l, const lbool* lit_assigns)
+{
+    return lit_assigns[l.toInt()] != l_False;
+}
+
+Lit* CMSat::find_non_false_scalar(Lit* k, Lit* end, const lbool* lit_assigns, uint32_t)
+{
+    for (; k != end; k++) {
+        if (not_false(*k, lit_assigns)) return k;
+    }
+    return end;
+}
+
+#ifdef CMS_X86_DISPATCH
+// The kernels gather the lbool of each literal with a 32-bit gather at byte
+// offset lit.toInt(), keeping the low byte. This reads 3 bytes past
+// lit_assigns[lit], so lanes with lit >= nLits-3 are masked off. Masked-off
+// lanes come back as l_Undef and get re-checked with the scalar test, as does
+// every candidate lane. A literal is false iff its byte is exactly 1
+// (l_False), l_Undef is 2 or 3.
+
+__attribute__((target("avx2")))
+static Lit* find_non_false_avx2(Lit* k, Lit* end, const lbool* lit_assigns, uint32_t nLits)
+{
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256i low_byte = _mm256_set1_epi32(0xff);
+    const __m256i undef = _mm256_set1_epi32(l_Undef.getValue());
+    const __m256i limit = _mm256_set1_epi32((int32_t)nLits - 3);
+    const int* base = reinterpret_cast<const int*>(lit_assigns);
+
+    for (; end - k >= 8; k += 8) {
+        const __m256i lits = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(k));
+        const __m256i safe = _mm256_cmpgt_epi32(limit, lits);
+        __m256i vals = _mm256_mask_i32gather_epi32(undef, base, lits, safe, 1);
+        vals = _mm256_and_si256(vals, low_byte);
+        const __m256i is_false = _mm256_cmpeq_epi32(vals, one);
+        uint32_t cands = ~(uint32_t)_mm256_movemask_ps(_mm256_castsi256_ps(is_false)) & 0xffU;
+        while (cands) {
+            const uint32_t at = __builtin_ctz(cands);
+            if (not_false(k[at], lit_assigns)) return k + at;
+            cands &= cands - 1;
+        }
+    }
+    return find_non_false_scalar(k, end, lit_assigns, nLits);
+}
+
+__attribute__((target("avx512f,avx512bw")))
+static Lit* find_non_false_avx512(Lit* k, Lit* end, const lbool* lit_assigns, uint32_t nLits)
+{
+    const __m512i one = _mm512_set1_epi32(1);
+    const __m512i low_byte = _mm512_set1_epi32(0xff);
+    const __m512i undef = _mm512_set1_epi32(l_Undef.getValue());
+    const __m512i limit = _mm512_set1_epi32((int32_t)nLits - 3);
+
+    for (; end - k >= 16; k += 16) {
+        const __m512i lits = _mm512_loadu_si512(k);
+        const __mmask16 safe = _mm512_cmplt_epi32_mask(lits, limit);
+        __m512i vals = _mm512_mask_i32gather_epi32(undef, safe, lits, lit_assigns, 1);
+        vals = _mm512_and_si512(vals, low_byte);
+        uint32_t cands = (uint16_t)~_mm512_cmpeq_epi32_mask(vals, one);
+        while (cands) {
+            const uint32_t at = __builtin_ctz(cands);
+            if (not_false(k[at], lit_assigns)) return k + at;
+            cands &= cands - 1;
+        }
+    }
+    // Tail of 8..15 literals is still worth a 256-bit block
+    return find_non_false_avx2(k, end, lit_assigns, nLits);
+}
+#endif
+
+FindNonFalse CMSat::get_find_non_false(const bool use_simd)
+{
+    #ifdef CMS_X86_DISPATCH
+    if (use_simd) {
+        const CPUFeatures& feat = cpu_features();
+        if (feat.avx512) return find_non_false_avx512;
+        if (feat.avx2) return find_non_false_avx2;
+    }
+    #else
+    (void)use_simd;
+    #endif
+    return find_non_false_scalar;
+}
+
+const char* CMSat::find_non_false_name(const FindNonFalse f)
+{
+    #ifdef CMS_X86_DISPATCH
+    if (f == find_non_false_avx512) return "avx512";
+    if (f == find_non_false_avx2) return "avx2";
+    #endif
+    (void)f;
+    return "scalar";
+}
+
+const char* CMSat::watch_search_bucket_name(const uint32_t bucket)
+{
+    switch (bucket) {
+        case 0: return "<10";
+        case 1: return "10-19";
+        case 2: return "20-49";
+        case 3: return "50-199";
+        default: return ">=200";
+    }
+}
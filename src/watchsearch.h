@@ -0,0 +1,62 @@
+/*************************************************************
+CryptoMiniSat --- Copyright (C) 2009-2020 Authors of CryptoMiniSat, see AUTHORS file
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+***************************************************************/
+
+#ifndef WATCHSEARCH_H
+#define WATCHSEARCH_H
+
+#include <cstdint>
+#include "solvertypesmini.h"
+
+namespace CMSat {
+
+// Returns the first literal in [k, end) whose value in the literal-indexed
+// 'lit_assigns' is not l_False, or 'end' if there is none. Used to find a new
+// watch for a long clause. nLits must be lit_assigns' size.
+typedef Lit* (*FindNonFalse)(Lit* k, Lit* end, const lbool* lit_assigns, uint32_t nLits);
+
+Lit* find_non_false_scalar(Lit* k, Lit* end, const lbool* lit_assigns, uint32_t nLits);
+
+// Best implementation for this CPU, or the scalar one if use_simd is false
+FindNonFalse get_find_non_false(bool use_simd);
+const char* find_non_false_name(FindNonFalse f);
+
+// Clauses shorter than this are searched with the inlined scalar loop,
+// a vector block would mostly be wasted on them.
+constexpr uint32_t watch_search_simd_min_size = 10;
+// Literals checked one by one before handing the rest to the vector search
+constexpr uint32_t watch_search_scalar_probe = 4;
+
+// Clause size buckets for the watch search stats
+constexpr uint32_t watch_search_buckets = 5;
+inline uint32_t watch_search_bucket(const uint32_t size)
+{
+    if (size < 10) return 0;
+    if (size < 20) return 1;
+    if (size < 50) return 2;
+    if (size < 200) return 3;
+    return 4;
+}
+const char* watch_search_bucket_name(uint32_t bucket);
+
+}
+
+#endif //WATCHSEARCH_H
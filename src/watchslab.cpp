@@ -0,0 +1,349 @@
+/*************************************************************
+CryptoMiniSat --- Copyright (C) 2009-2020 Authors of CryptoMiniSat, see AUTHORS file
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+***************************************************************/
+
+#include "watchslab.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstdlib>
+#include <limits>
+#include <new>
+
+using namespace CMSat;
+
+static_assert(sizeof(Watched) >= sizeof(WatchSlab*), "The owner of a block is stored in a Watched slot");
+
+//Chunks start small, so small instances don't pay for them, and double up to this
+static constexpr uint64_t min_chunk_len = 1ULL << 15;
+static constexpr uint64_t max_chunk_len = 1ULL << 21;
+
+static uint32_t size_class(const uint32_t cap)
+{
+    return std::bit_width(cap) - 1;
+}
+
+WatchSlab::WatchSlab() :
+    next_chunk_len(min_chunk_len)
+{
+    std::fill(free_head, free_head + num_classes, nullptr);
+    set_owner(empty_list_data());
+}
+
+WatchSlab::~WatchSlab()
+{
+    for(const auto& c: chunks) {
+        free_chunk(c);
+    }
+}
+
+void WatchSlab::set_owner(Watched* data)
+{
+    WatchSlab* me = this;
+    memcpy((void*)(data - 1), &me, sizeof(me));
+}
+
+static Watched* get_link(const Watched* at)
+{
+    Watched* ptr;
+    memcpy(&ptr, at, sizeof(ptr));
+    return ptr;
+}
+
+static void set_link(Watched* at, Watched* ptr)
+{
+    memcpy((void*)at, &ptr, sizeof(ptr));
+}
+
+//Pointers are aligned, so a set lowest bit means a free block. Its first two
+//slots are the next and previous block in its free list
+void WatchSlab::link_free(Watched* data, const uint32_t cap)
+{
+    const uint64_t tag = ((uint64_t)cap << 1) | 1U;
+    memcpy((void*)(data - 1), &tag, sizeof(tag));
+    if (cap < 2) return;
+
+    Watched*& head = free_head[size_class(cap)];
+    set_link(data, head);
+    set_link(data + 1, nullptr);
+    if (head != nullptr) {
+        set_link(head + 1, data);
+    }
+    head = data;
+}
+
+void WatchSlab::unlink_free(Watched* data, const uint32_t cap)
+{
+    if (cap < 2) return;
+
+    Watched* next = get_link(data);
+    Watched* prev = get_link(data + 1);
+    if (prev != nullptr) {
+        set_link(prev, next);
+    } else {
+        free_head[size_class(cap)] = next;
+    }
+    if (next != nullptr) {
+        set_link(next + 1, prev);
+    }
+}
+
+bool WatchSlab::next_free(Watched* data, const uint64_t cap, uint32_t& next_cap) const
+{
+    const Watched* next = data + cap;
+    if (next == top) return false;
+
+    uint64_t tag;
+    memcpy(&tag, next, sizeof(tag));
+    if (!(tag & 1U)) return false;
+    next_cap = tag >> 1;
+    return true;
+}
+
+WatchSlab::Chunk WatchSlab::new_chunk(const uint64_t len)
+{
+    Chunk c;
+    c.huge = use_hugepages;
+    if (c.huge) {
+        //The rest of the last huge page would be wasted otherwise
+        c.len = huge_round((len+1)*sizeof(Watched))/sizeof(Watched) - 1;
+        c.start = (Watched*)huge_alloc((c.len+1)*sizeof(Watched));
+    } else {
+        c.len = len;
+        c.start = (Watched*)malloc((c.len+1)*sizeof(Watched));
+    }
+    if (c.start == nullptr) {
+        throw std::bad_alloc();
+    }
+
+    //Guard at the end, so blocks are never merged past it
+    set_owner(c.start + c.len + 1);
+    return c;
+}
+
+void WatchSlab::free_chunk(const Chunk& c)
+{
+    if (c.huge) {
+        huge_free(c.start, (c.len+1)*sizeof(Watched));
+    } else {
+        free(c.start);
+    }
+}
+
+/**
+@brief Returns the data of a block of at least 'cap' elements, with its owner set
+
+Free blocks are reused first. A larger one is split, and the rest of it goes
+back to the free lists. In the list of the requested size only the first few
+blocks are looked at, any block in the larger lists is big enough.
+*/
+Watched* WatchSlab::alloc_block(const uint32_t cap, uint32_t& got_cap)
+{
+    for(uint32_t c = size_class(cap); c < num_classes; c++) {
+        uint32_t tries = 0;
+        for(Watched* b = free_head[c]; b != nullptr && tries < 8; b = get_link(b), tries++) {
+            uint64_t tag;
+            memcpy(&tag, b - 1, sizeof(tag));
+            const uint32_t b_cap = tag >> 1;
+            if (b_cap < cap) continue;
+
+            unlink_free(b, b_cap);
+            set_owner(b);
+            got_cap = b_cap;
+            if (b_cap - cap >= 2) {
+                release(b + cap + 1, b_cap - cap - 1);
+                got_cap = cap;
+            }
+            return b;
+        }
+    }
+
+    if (top == nullptr || (uint64_t)(top_end - top) < (uint64_t)cap + 1) {
+        //The rest of the last chunk is kept as a free block. A single slot
+        //left can't be one, it's marked as used so it's never merged
+        if (top != nullptr && top_end - top >= 2) {
+            Watched* rest = top + 1;
+            const uint32_t rest_cap = top_end - rest;
+            top = nullptr;
+            release(rest, rest_cap);
+        } else if (top != nullptr && top != top_end) {
+            set_owner(top + 1);
+        }
+        const Chunk c = new_chunk(std::max<uint64_t>(next_chunk_len, (uint64_t)cap + 1));
+        chunks.push_back(c);
+        next_chunk_len = std::min(next_chunk_len*2, max_chunk_len);
+        top = c.start;
+        top_end = c.start + c.len;
+    }
+
+    Watched* data = top + 1;
+    top += cap + 1;
+    set_owner(data);
+    got_cap = cap;
+    return data;
+}
+
+void WatchSlab::release(Watched* data, uint32_t cap)
+{
+    assert(cap > 0);
+
+    //Merge with the free blocks after it
+    uint32_t next_cap;
+    while (next_free(data, cap, next_cap)
+        && (uint64_t)cap + 1 + next_cap < std::numeric_limits<uint32_t>::max()
+    ) {
+        unlink_free(data + cap + 1, next_cap);
+        cap += 1 + next_cap;
+    }
+
+    if (data + cap == top) {
+        //Block at the top, give it back
+        top = data - 1;
+        return;
+    }
+    link_free(data, cap);
+}
+
+void WatchSlab::grow(watch_list& ws, const uint32_t min_cap)
+{
+    assert(ws.data != nullptr && "watch_list not initialised by watch_array");
+    if (min_cap <= ws.cap) return;
+    //Grow by about 3/2, like vec<>
+    const uint32_t new_cap = std::max<uint32_t>({min_cap, ws.cap + ws.cap/2, 3});
+
+    if (ws.cap > 0) {
+        //At the top of the last chunk, it can grow into the free space there
+        if (ws.data + ws.cap == top
+            && (uint64_t)(top_end - top) >= new_cap - ws.cap
+        ) {
+            top += new_cap - ws.cap;
+            ws.cap = new_cap;
+            return;
+        }
+
+        //Take the free blocks after it
+        uint32_t next_cap = 0;
+        uint64_t cap = ws.cap;
+        while (cap < new_cap && next_free(ws.data, cap, next_cap)) {
+            cap += 1 + next_cap;
+        }
+        if (cap >= new_cap && cap < std::numeric_limits<uint32_t>::max()) {
+            //Only taken from the free lists now that they surely fit
+            uint64_t at = ws.cap;
+            while (at < cap) {
+                next_free(ws.data, at, next_cap);
+                unlink_free(ws.data + at + 1, next_cap);
+                at += 1 + next_cap;
+            }
+            ws.cap = cap;
+            if (cap - new_cap >= 2) {
+                release(ws.data + new_cap + 1, cap - new_cap - 1);
+                ws.cap = new_cap;
+            }
+            return;
+        }
+    }
+
+    uint32_t got_cap;
+    Watched* data = alloc_block(new_cap, got_cap);
+    if (ws.sz > 0) {
+        memcpy((void*)data, ws.data, ws.sz*sizeof(Watched));
+    }
+    if (ws.cap > 0) {
+        release(ws.data, ws.cap);
+    }
+    ws.data = data;
+    ws.cap = got_cap;
+}
+
+void watch_list::shrink_to_fit()
+{
+    if (sz == 0) {
+        clear(true);
+        return;
+    }
+
+    //The unused end becomes a block of its own
+    if (cap - sz >= 2) {
+        slab()->release(data + sz + 1, cap - sz - 1);
+        cap = sz;
+    }
+}
+
+void WatchSlab::compact(watch_list* begin, watch_list* end, const bool gaps)
+{
+    uint64_t total = 0;
+    for(watch_list* ws = begin; ws != end; ws++) {
+        if (ws->sz == 0) continue;
+        total += ws->sz + (gaps ? ws->sz/4 + 1 : 0) + 1;
+    }
+
+    vector<Chunk> old_chunks;
+    old_chunks.swap(chunks);
+    top = nullptr;
+    top_end = nullptr;
+    std::fill(free_head, free_head + num_classes, nullptr);
+
+    if (total > 0) {
+        const Chunk c = new_chunk(total);
+        chunks.push_back(c);
+        top = c.start;
+        top_end = c.start + c.len;
+    }
+    next_chunk_len = std::clamp<uint64_t>(total/8, min_chunk_len, max_chunk_len);
+
+    for(watch_list* ws = begin; ws != end; ws++) {
+        if (ws->sz == 0) {
+            ws->data = empty_list_data();
+            ws->cap = 0;
+            continue;
+        }
+        const uint32_t cap = ws->sz + (gaps ? ws->sz/4 + 1 : 0);
+        Watched* data = top + 1;
+        top += cap + 1;
+        set_owner(data);
+        memcpy((void*)data, ws->data, ws->sz*sizeof(Watched));
+        ws->data = data;
+        ws->cap = cap;
+    }
+    assert(top <= top_end);
+
+    for(const auto& c: old_chunks) {
+        free_chunk(c);
+    }
+}
+
+uint64_t WatchSlab::mem_used() const
+{
+    uint64_t mem = 0;
+    for(const auto& c: chunks) {
+        mem += c.len*sizeof(Watched);
+    }
+    mem += chunks.capacity()*sizeof(Chunk);
+    return mem;
+}
+
+void WatchSlab::add_ranges(vector<MemRange>& ranges) const
+{
+    for(const auto& c: chunks) {
+        ranges.push_back(MemRange{c.start, c.len*sizeof(Watched)});
+    }
+}
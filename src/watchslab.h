@@ -0,0 +1,240 @@
+/*************************************************************
+CryptoMiniSat --- Copyright (C) 2009-2020 Authors of CryptoMiniSat, see AUTHORS file
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+***************************************************************/
+
+#ifndef WATCHSLAB_H
+#define WATCHSLAB_H
+
+#include "watched.h"
+#include "Vec.h"
+#include "hugepages.h"
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace CMSat {
+using std::vector;
+
+class WatchSlab;
+
+/**
+@brief A watchlist whose elements live in a WatchSlab
+
+It has the same interface as vec<Watched>. The slot just before 'data' holds
+the slab the list belongs to, so growing the list needs no slab pointer in
+every list. Empty lists point just after such a slot in the slab itself.
+*/
+class watch_list
+{
+public:
+    Watched* data;
+    Watched* begin() { return data; }
+    Watched* end() { return data + sz; }
+    const Watched* begin() const { return data; }
+    const Watched* end() const { return data + sz; }
+
+    watch_list() : data(nullptr), sz(0), cap(0) {}
+    ~watch_list() { clear(true); }
+    watch_list(const watch_list&) = delete;
+    watch_list& operator=(const watch_list&) = delete;
+
+    uint32_t size() const { return sz; }
+    bool empty() const { return sz == 0; }
+    uint32_t capacity() const { return cap; }
+
+    void shrink(const uint32_t nelems)
+    {
+        assert(nelems <= sz);
+        sz -= nelems;
+    }
+    void shrink_(const uint32_t nelems)
+    {
+        assert(nelems <= sz);
+        sz -= nelems;
+    }
+
+    void push(const Watched& elem)
+    {
+        if (sz == cap) {
+            grow(sz + 1);
+        }
+        data[sz++] = elem;
+    }
+    void push_(const Watched& elem)
+    {
+        assert(sz < cap);
+        data[sz++] = elem;
+    }
+    void pop()
+    {
+        assert(sz > 0);
+        sz--;
+    }
+    const Watched& last() const { return data[sz - 1]; }
+    Watched& last() { return data[sz - 1]; }
+
+    const Watched& operator[](const uint32_t index) const { return data[index]; }
+    Watched& operator[](const uint32_t index) { return data[index]; }
+
+    void copyTo(vec<Watched>& copy) const
+    {
+        copy.clear();
+        copy.growTo(sz);
+        for (uint32_t i = 0; i < sz; i++) {
+            copy[i] = data[i];
+        }
+    }
+
+    void moveTo(vec<Watched>& dest)
+    {
+        copyTo(dest);
+        clear(true);
+    }
+
+    //Only between lists of the same slab
+    void swap(watch_list& other)
+    {
+        std::swap(data, other.data);
+        std::swap(sz, other.sz);
+        std::swap(cap, other.cap);
+    }
+
+    void resize(const uint32_t s)
+    {
+        if (s < sz) {
+            shrink(sz - s);
+            return;
+        }
+        if (s > cap) {
+            grow(s);
+        }
+        for (uint32_t i = sz; i < s; i++) {
+            new (&data[i]) Watched();
+        }
+        sz = s;
+    }
+
+    void clear(const bool dealloc = false);
+    void shrink_to_fit();
+
+private:
+    uint32_t sz;
+    uint32_t cap;
+
+    WatchSlab* slab() const
+    {
+        WatchSlab* s;
+        memcpy(&s, data - 1, sizeof(s));
+        return s;
+    }
+    void grow(const uint32_t min_cap);
+
+    friend class WatchSlab;
+};
+
+/**
+@brief Allocator holding all watchlists of a solver in a few large chunks
+
+Instead of every watchlist being malloc()-ed on its own, they are carved out
+of large chunks. Every block starts with a slot that holds either the slab (the
+block is in use) or the block's size (it's free). A list that runs out of space
+grows in place if the block after it is free, or it's at the top of the last
+chunk. Otherwise it's moved to a block about 3/2 its size, and its old block
+is merged with any free block after it, and goes to a per-size free list. The
+free lists are linked through the free blocks themselves. Chunks are
+never moved while the solver runs, so growing a list only invalidates pointers
+into that list, as with vec<Watched>.
+
+compact() puts all lists into a single chunk, in literal order, so the lists of
+neighbouring literals are next to each other, and the holes are gone.
+*/
+class WatchSlab
+{
+public:
+    WatchSlab();
+    ~WatchSlab();
+    WatchSlab(const WatchSlab&) = delete;
+    WatchSlab& operator=(const WatchSlab&) = delete;
+
+    //What empty lists point to
+    Watched* empty_list_data() { return &sentinel[1]; }
+
+    //Lists in [begin, end) are laid out in order into a new chunk. With
+    //'gaps' every list gets some free space after it, to grow into
+    void compact(watch_list* begin, watch_list* end, const bool gaps);
+
+    void set_hugepages(const bool huge) { use_hugepages = huge; }
+
+    uint64_t mem_used() const; ///<Bytes in chunks
+    size_t num_chunks() const { return chunks.size(); }
+    void add_ranges(vector<MemRange>& ranges) const;
+
+private:
+    struct Chunk {
+        Watched* start;
+        uint64_t len; ///<Number of Watched it can hold
+        bool huge;
+    };
+    vector<Chunk> chunks;
+    Watched* top = nullptr; ///<Next free slot of the last chunk
+    Watched* top_end = nullptr; ///<End of the last chunk, there is a guard slot here
+    uint64_t next_chunk_len;
+
+    //Blocks of capacity [2^i, 2^(i+1)) are in the list of free_head[i]. The
+    //ones with capacity 1 can't hold the links, they can only be merged
+    static constexpr uint32_t num_classes = 32;
+    Watched* free_head[num_classes];
+
+    bool use_hugepages = false;
+    Watched sentinel[2];
+
+    void grow(watch_list& ws, const uint32_t min_cap);
+    void release(Watched* data, uint32_t cap);
+    Watched* alloc_block(const uint32_t cap, uint32_t& got_cap);
+    void set_owner(Watched* data);
+    void link_free(Watched* data, const uint32_t cap);
+    void unlink_free(Watched* data, const uint32_t cap);
+    bool next_free(Watched* data, const uint64_t cap, uint32_t& next_cap) const;
+    Chunk new_chunk(const uint64_t len);
+    void free_chunk(const Chunk& c);
+
+    friend class watch_list;
+};
+
+inline void watch_list::grow(const uint32_t min_cap)
+{
+    slab()->grow(*this, min_cap);
+}
+
+inline void watch_list::clear(const bool dealloc)
+{
+    sz = 0;
+    if (dealloc && cap > 0) {
+        WatchSlab* s = slab();
+        s->release(data, cap);
+        data = s->empty_list_data();
+        cap = 0;
+    }
+}
+
+} //End of namespace
+
+#endif //WATCHSLAB_H
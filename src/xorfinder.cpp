@@ -66,8 +66,8 @@ void XorFinder::find_xors_based_on_long_clauses() {
         if (cl->size() > solver->conf.maxXorToFind) continue;
 
         //If not tried already, find an XOR with it
-        if (!cl->stats.marked_clause ) {
-            cl->stats.marked_clause = 1;
+        if (!cl->marked_clause ) {
+            cl->marked_clause = 1;
             assert(!cl->get_removed());
 
             size_t needed_per_ws = 1ULL << (cl->size()-2);
@@ -151,7 +151,7 @@ bool XorFinder::find_xors() {
     //Cleanup
     for(ClOffset offset: occsimplifier->clauses) {
         Clause* cl = solver->cl_alloc.ptr(offset);
-        cl->stats.marked_clause = 0;
+        cl->marked_clause = 0;
     }
 
     //Print stats
@@ -245,7 +245,7 @@ void XorFinder::add_found_xor(const Xor& found_xor)
             auto cl = *solver->cl_alloc.ptr(off);
             assert(!cl.freed());
             assert(!cl.get_removed());
-            solver->chain.push_back(cl.stats.id);
+            solver->chain.push_back(cl.id);
         }
         *solver->frat << implyxfromcls << added; solver->add_chain(); *solver->frat << fin;
     }
@@ -341,7 +341,7 @@ void XorFinder::findXorMatch(watch_subarray_const occ, const Lit wlit)
             //there is no point in using this clause as a base for another XOR
             //because exactly the same things will be found.
             if (cl.size() == poss_xor.getSize()) {
-                cl.stats.marked_clause = 1;
+                cl.marked_clause = 1;
             }
 
             xor_find_time_limit -= cl.size()/4+1;
@@ -112,6 +112,204 @@ TEST(normal_interface, solve_multi_thread)
     EXPECT_EQ(s.get_model()[1], l_True);
 }
 
+TEST(normal_interface, change_num_threads_between_solves)
+{
+    SATSolver s;
+    s.set_num_threads(2);
+    s.new_vars(3);
+    s.add_clause(str_to_cl("1, 2"));
+    lbool ret = s.solve();
+    EXPECT_EQ( ret, l_True);
+
+    s.set_num_threads(4);
+    s.add_clause(str_to_cl("-1"));
+    ret = s.solve();
+    EXPECT_EQ( ret, l_True);
+    EXPECT_EQ(s.get_model()[0], l_False);
+    EXPECT_EQ(s.get_model()[1], l_True);
+
+    s.set_num_threads(1);
+    s.add_clause(str_to_cl("-2, 3"));
+    ret = s.solve();
+    EXPECT_EQ( ret, l_True);
+    EXPECT_EQ(s.get_model()[2], l_True);
+
+    s.set_num_threads(3);
+    s.add_clause(str_to_cl("-3"));
+    ret = s.solve();
+    EXPECT_EQ( ret, l_False);
+    EXPECT_EQ( s.okay(), false);
+}
+
+TEST(normal_interface, cube_and_conquer)
+{
+    //Pigeons 0..5 into holes 0..4, var of pigeon p in hole h is p*5+h
+    SATSolver s;
+    s.set_cube_and_conquer(10);
+    s.set_num_threads(3);
+    s.new_vars(30);
+    for(uint32_t p = 0; p < 6; p++) {
+        vector<Lit> cl;
+        for(uint32_t h = 0; h < 5; h++) cl.push_back(Lit(p*5+h, false));
+        s.add_clause(cl);
+    }
+    lbool ret = s.solve();
+    EXPECT_EQ( ret, l_True);
+    for(uint32_t p = 0; p < 6; p++) {
+        bool in_hole = false;
+        for(uint32_t h = 0; h < 5; h++) in_hole |= s.get_model()[p*5+h] == l_True;
+        EXPECT_TRUE(in_hole);
+    }
+
+    for(uint32_t h = 0; h < 5; h++) {
+        for(uint32_t p1 = 0; p1 < 6; p1++) {
+            for(uint32_t p2 = p1+1; p2 < 6; p2++) {
+                s.add_clause(vector<Lit>{Lit(p1*5+h, true), Lit(p2*5+h, true)});
+            }
+        }
+    }
+    vector<Lit> assumps = {Lit(0, false)};
+    ret = s.solve(&assumps);
+    EXPECT_EQ( ret, l_False);
+
+    ret = s.solve();
+    EXPECT_EQ( ret, l_False);
+    EXPECT_EQ( s.okay(), false);
+    EXPECT_TRUE( s.get_conflict().empty());
+}
+
+TEST(normal_interface, pin_threads)
+{
+    for(int pin = 1; pin <= 2; pin++) {
+        SATSolver s;
+        s.set_pin_threads(pin);
+        s.set_num_threads(3);
+        s.new_vars(3);
+        s.add_clause(str_to_cl("1, 2"));
+        s.add_clause(str_to_cl("-1, 3"));
+        lbool ret = s.solve();
+        EXPECT_EQ( ret, l_True);
+
+        s.add_clause(str_to_cl("-3"));
+        s.add_clause(str_to_cl("-2"));
+        ret = s.solve();
+        EXPECT_EQ( ret, l_False);
+    }
+}
+
+TEST(normal_interface, deterministic)
+{
+    //Random 3-SAT near the threshold, with a fixed LCG so it's the same every time
+    vector<vector<Lit>> cls;
+    uint64_t x = 42;
+    for(uint32_t i = 0; i < 800; i++) {
+        vector<Lit> cl;
+        for(uint32_t j = 0; j < 3; j++) {
+            x = x*6364136223846793005ULL + 1442695040888963407ULL;
+            cl.push_back(Lit((x >> 33) % 200, (x >> 20) & 1));
+        }
+        cls.push_back(cl);
+    }
+
+    vector<vector<lbool>> models[2];
+    for(int run = 0; run < 2; run++) {
+        SATSolver s;
+        s.set_deterministic();
+        s.set_num_threads(3);
+        s.new_vars(200);
+        for(const auto& cl: cls) s.add_clause(cl);
+        for(int i = 0; i < 3; i++) {
+            lbool ret = s.solve();
+            if (ret != l_True) break;
+            models[run].push_back(s.get_model());
+            vector<Lit> ban;
+            for(uint32_t v = 0; v < 200; v++) ban.push_back(Lit(v, s.get_model()[v] == l_True));
+            s.add_clause(ban);
+        }
+    }
+    EXPECT_FALSE(models[0].empty());
+    EXPECT_EQ(models[0], models[1]);
+}
+
+TEST(normal_interface, comp_solve)
+{
+    //4 disjoint components of 3 variables each
+    SATSolver s;
+    s.set_comp_solve(2);
+    s.new_vars(12);
+    for(uint32_t i = 0; i < 4; i++) {
+        const uint32_t a = i*3, b = i*3+1, c = i*3+2;
+        s.add_clause(vector<Lit>{Lit(a, false), Lit(b, false)});
+        s.add_clause(vector<Lit>{Lit(a, true), Lit(c, false)});
+        s.add_clause(vector<Lit>{Lit(b, true), Lit(c, true)});
+    }
+
+    lbool ret = s.solve();
+    EXPECT_EQ(ret, l_True);
+    for(uint32_t i = 0; i < 4; i++) {
+        const auto& m = s.get_model();
+        EXPECT_TRUE(m[i*3] == l_True || m[i*3+1] == l_True);
+        EXPECT_TRUE(m[i*3] == l_False || m[i*3+2] == l_True);
+        EXPECT_TRUE(m[i*3+1] == l_False || m[i*3+2] == l_False);
+    }
+
+    //Only the assumptions of the conflicting component end up in the conflict
+    vector<Lit> assumps{Lit(0, true), Lit(6, false), Lit(7, false)};
+    ret = s.solve(&assumps);
+    EXPECT_EQ(ret, l_False);
+    for(const Lit l: s.get_conflict()) {
+        EXPECT_TRUE(l.var() == 6 || l.var() == 7);
+    }
+
+    s.add_clause(vector<Lit>{Lit(9, false)});
+    s.add_clause(vector<Lit>{Lit(10, false)});
+    ret = s.solve();
+    EXPECT_EQ(ret, l_False);
+}
+
+TEST(normal_interface, solve_batch)
+{
+    SATSolver s;
+    s.set_num_threads(3);
+    s.new_vars(4);
+    s.add_clause(str_to_cl("1, 2"));
+    s.add_clause(str_to_cl("-1, 3"));
+    s.add_clause(str_to_cl("-2, -3"));
+
+    vector<vector<Lit>> queries;
+    queries.push_back(str_to_cl("1"));
+    queries.push_back(str_to_cl("1, 2, 4"));
+    queries.push_back(str_to_cl("-1, -4"));
+    queries.push_back(str_to_cl("3, -3"));
+    queries.push_back(vector<Lit>());
+    vector<lbool> ret = s.solve_batch(queries);
+    ASSERT_EQ(ret.size(), 5u);
+    EXPECT_EQ(ret[0], l_True);
+    EXPECT_EQ(ret[1], l_False);
+    EXPECT_EQ(ret[2], l_True);
+    EXPECT_EQ(ret[3], l_False);
+    EXPECT_EQ(ret[4], l_True);
+
+    EXPECT_EQ(s.get_batch_model(0)[0], l_True);
+    EXPECT_EQ(s.get_batch_model(0)[2], l_True);
+    EXPECT_EQ(s.get_batch_model(2)[1], l_True);
+    EXPECT_EQ(s.get_batch_model(2)[3], l_False);
+    for(const Lit l: s.get_batch_conflict(1)) {
+        EXPECT_TRUE(l == Lit(0, true) || l == Lit(1, true));
+    }
+    EXPECT_FALSE(s.get_batch_conflict(1).empty());
+    EXPECT_FALSE(s.get_batch_conflict(3).empty());
+
+    //UNSAT without assumptions makes all of them UNSAT
+    s.add_clause(str_to_cl("1"));
+    s.add_clause(str_to_cl("2"));
+    ret = s.solve_batch(queries);
+    for(size_t i = 0; i < queries.size(); i++) {
+        EXPECT_EQ(ret[i], l_False);
+        EXPECT_TRUE(s.get_batch_conflict(i).empty());
+    }
+}
+
 TEST(normal_interface, logfile)
 {
     SATSolver* s = new SATSolver();
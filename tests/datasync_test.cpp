@@ -0,0 +1,228 @@
+/******************************************
+Copyright (C) 2009-2020 Authors of CryptoMiniSat, see AUTHORS file
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+***********************************************/
+
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "src/shareddata.h"
+
+using namespace CMSat;
+using std::vector;
+
+TEST(shared_units, set_get)
+{
+    SharedUnits units;
+    EXPECT_EQ(units.get(0), l_Undef);
+    EXPECT_EQ(units.get(var_Undef - 1), l_Undef);
+    EXPECT_EQ(units.set(5, l_True), l_True);
+    EXPECT_EQ(units.get(5), l_True);
+    EXPECT_EQ(units.set(5, l_False), l_True);
+    EXPECT_EQ(units.set(1U << 20, l_False), l_False);
+    EXPECT_EQ(units.get(1U << 20), l_False);
+    EXPECT_EQ(units.get((1U << 20) + 1), l_Undef);
+}
+
+TEST(shared_units, race)
+{
+    SharedUnits units;
+    const uint32_t num_threads = 4;
+    const uint32_t num_vars = 200000;
+    vector<vector<lbool>> got(num_threads, vector<lbool>(num_vars));
+    vector<std::thread> threads;
+    for(uint32_t t = 0; t < num_threads; t++) {
+        threads.emplace_back([&, t] {
+            for(uint32_t v = 0; v < num_vars; v++) {
+                got[t][v] = units.set(v, lbool((uint8_t)((v + t) & 1)));
+            }
+        });
+    }
+    for(auto& th: threads) th.join();
+
+    //Everybody agrees on who won
+    for(uint32_t v = 0; v < num_vars; v++) {
+        for(uint32_t t = 0; t < num_threads; t++) {
+            EXPECT_EQ(got[t][v], units.get(v));
+        }
+    }
+}
+
+TEST(bin_log, read_while_written)
+{
+    BinLog log;
+    const uint32_t num = 100000;
+    std::atomic<bool> done(false);
+    std::thread writer([&] {
+        for(uint32_t i = 0; i < num; i++) {
+            log.push(Lit(i, false), Lit(i+1, true));
+        }
+        done = true;
+    });
+
+    BinLog::Cursor cur;
+    uint32_t expect = 0;
+    auto check = [&](const Lit lit1, const Lit lit2) {
+        EXPECT_EQ(lit1, Lit(expect, false));
+        EXPECT_EQ(lit2, Lit(expect+1, true));
+        expect++;
+    };
+    while (!done) {
+        log.read(cur, check);
+    }
+    writer.join();
+    log.read(cur, check);
+    EXPECT_EQ(expect, num);
+    EXPECT_EQ(log.size(), num);
+}
+
+TEST(clause_ring, lapped_reader_loses_clauses)
+{
+    ClauseRing ring(1024);
+    vector<Lit> cl = {Lit(1, false), Lit(2, true), Lit(3, false)};
+    uint64_t at = 0;
+    vector<uint32_t> out;
+
+    ring.push(cl.data(), cl.size(), 2);
+    EXPECT_TRUE(ring.read(at, out));
+    ASSERT_EQ(out.size(), 5U);
+    EXPECT_EQ(out[0], 3U);
+    EXPECT_EQ(out[1], 2U);
+    EXPECT_EQ(Lit::toLit(out[3]), Lit(2, true));
+
+    for(uint32_t i = 0; i < 1000; i++) {
+        ring.push(cl.data(), cl.size(), 2);
+    }
+    out.clear();
+    EXPECT_FALSE(ring.read(at, out));
+    EXPECT_TRUE(out.empty());
+
+    //Caught up, nothing is lost from here on
+    ring.push(cl.data(), cl.size(), 2);
+    EXPECT_TRUE(ring.read(at, out));
+    EXPECT_EQ(out.size(), 5U);
+}
+
+//What every thread does at a sync, but with the solver taken out: look at all
+//units, set some, send a few binaries, and read the binaries of the others
+struct contention : public ::testing::Test {
+    static constexpr uint32_t num_vars = 20000;
+    static constexpr uint32_t num_syncs = 50;
+    static constexpr uint32_t bins_per_sync = 100;
+
+    //How it was done with one lock for units and one for binaries
+    struct Locked {
+        std::mutex unit_mutex;
+        vector<lbool> value = vector<lbool>(num_vars, l_Undef);
+        std::mutex bin_mutex;
+        vector<vector<Lit>> bins = vector<vector<Lit>>(2*num_vars);
+    };
+
+    static uint64_t sync_locked(Locked& d, const uint32_t tid, const uint32_t round)
+    {
+        uint64_t seen = 0;
+        {
+            std::lock_guard<std::mutex> lock(d.unit_mutex);
+            for(uint32_t v = 0; v < num_vars; v++) {
+                if (d.value[v] != l_Undef) seen++;
+                else if ((v + round*7 + tid) % 997 == 0) d.value[v] = l_True;
+            }
+        }
+        {
+            std::lock_guard<std::mutex> lock(d.bin_mutex);
+            for(uint32_t i = 0; i < bins_per_sync; i++) {
+                const uint32_t v = (tid*131 + round*bins_per_sync + i) % (num_vars - 1);
+                d.bins[Lit(v, false).toInt()].push_back(Lit(v+1, true));
+            }
+            for(const auto& b: d.bins) seen += b.size();
+        }
+        return seen;
+    }
+
+    struct LockFree {
+        SharedUnits units;
+        vector<std::unique_ptr<BinLog>> logs;
+    };
+
+    static uint64_t sync_lock_free(
+        LockFree& d, vector<BinLog::Cursor>& cur, const uint32_t tid, const uint32_t round)
+    {
+        uint64_t seen = 0;
+        for(uint32_t v = 0; v < num_vars; v++) {
+            if (d.units.get(v) != l_Undef) seen++;
+            else if ((v + round*7 + tid) % 997 == 0) d.units.set(v, l_True);
+        }
+        for(uint32_t i = 0; i < bins_per_sync; i++) {
+            const uint32_t v = (tid*131 + round*bins_per_sync + i) % (num_vars - 1);
+            d.logs[tid]->push(Lit(v, false), Lit(v+1, true));
+        }
+        for(uint32_t t = 0; t < d.logs.size(); t++) {
+            if (t != tid) d.logs[t]->read(cur[t], [&](Lit, Lit) { seen++; });
+        }
+        return seen;
+    }
+
+    template<class F> static double time_threads(const uint32_t num_threads, F f)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        vector<std::thread> threads;
+        for(uint32_t t = 0; t < num_threads; t++) {
+            threads.emplace_back(f, t);
+        }
+        for(auto& th: threads) th.join();
+        const std::chrono::duration<double> took = std::chrono::steady_clock::now() - start;
+        return took.count();
+    }
+};
+
+TEST_F(contention, vary_threads)
+{
+    std::cout << "c threads  locked(s)  lock-free(s)" << std::endl;
+    for(const uint32_t num_threads: {1U, 2U, 4U, 8U, 16U}) {
+        Locked locked;
+        const double t_locked = time_threads(num_threads, [&](const uint32_t tid) {
+            for(uint32_t r = 0; r < num_syncs; r++) sync_locked(locked, tid, r);
+        });
+
+        LockFree lock_free;
+        for(uint32_t t = 0; t < num_threads; t++) {
+            lock_free.logs.push_back(std::make_unique<BinLog>());
+        }
+        const double t_lock_free = time_threads(num_threads, [&](const uint32_t tid) {
+            vector<BinLog::Cursor> cur(num_threads);
+            for(uint32_t r = 0; r < num_syncs; r++) sync_lock_free(lock_free, cur, tid, r);
+        });
+
+        //Everything sent got into the logs
+        for(const auto& l: lock_free.logs) {
+            EXPECT_EQ(l->size(), num_syncs*bins_per_sync);
+        }
+        std::cout << "c " << std::setw(7) << num_threads
+            << std::setw(11) << std::fixed << std::setprecision(3) << t_locked
+            << std::setw(14) << t_lock_free << std::endl;
+    }
+}
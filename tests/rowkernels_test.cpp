@@ -0,0 +1,111 @@
+/*************************************************************
+CryptoMiniSat --- Copyright (C) 2009-2020 Authors of CryptoMiniSat, see AUTHORS file
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+***************************************************************/
+
+#include "gtest/gtest.h"
+
+#include <random>
+#include <vector>
+#include "src/rowkernels.h"
+
+using namespace CMSat;
+using std::vector;
+
+struct row_kernels_test : public ::testing::Test {
+    std::mt19937_64 mtrand{42};
+
+    //Few bits set, so set_and_popcnt_atleast2 often goes to the end
+    vector<int64_t> rnd_row(const uint32_t n, const bool sparse)
+    {
+        vector<int64_t> row(n);
+        for(auto& w: row) {
+            w = sparse ? (mtrand() % 16 == 0 ? 1LL << (mtrand() % 64) : 0) : (int64_t)mtrand();
+        }
+        return row;
+    }
+
+    void check(const RowKernels& k, const uint32_t n, const bool sparse)
+    {
+        const RowKernels& s = row_kernels_scalar();
+        const vector<int64_t> a = rnd_row(n, sparse);
+        const vector<int64_t> b = rnd_row(n, false);
+
+        vector<int64_t> x1 = a, x2 = a;
+        s.xor_into(x1.data(), b.data(), n);
+        k.xor_into(x2.data(), b.data(), n);
+        EXPECT_EQ(x1, x2);
+
+        x1 = a; x2 = a;
+        s.and_inv(x1.data(), b.data(), n);
+        k.and_inv(x2.data(), b.data(), n);
+        EXPECT_EQ(x1, x2);
+
+        vector<int64_t> out1(n, -1), out2(n, -1);
+        s.set_xor(out1.data(), a.data(), b.data(), n);
+        k.set_xor(out2.data(), a.data(), b.data(), n);
+        EXPECT_EQ(out1, out2);
+
+        s.set_and_inv(out1.data(), a.data(), b.data(), n);
+        k.set_and_inv(out2.data(), a.data(), b.data(), n);
+        EXPECT_EQ(out1, out2);
+
+        s.set_and(out1.data(), a.data(), b.data(), n);
+        k.set_and(out2.data(), a.data(), b.data(), n);
+        EXPECT_EQ(out1, out2);
+        EXPECT_EQ(s.popcnt(out1.data(), n), k.popcnt(out1.data(), n));
+
+        //Below 2 it's exact and all is written, the rest may differ
+        vector<int64_t> full(n);
+        s.set_and(full.data(), a.data(), b.data(), n);
+        const uint32_t pop = s.popcnt(full.data(), n);
+        out2.assign(n, -1);
+        const uint32_t pop2 = k.set_and_popcnt_atleast2(out2.data(), a.data(), b.data(), n);
+        if (pop < 2) {
+            EXPECT_EQ(pop, pop2);
+            EXPECT_EQ(full, out2);
+        } else {
+            EXPECT_GE(pop2, 2u);
+            EXPECT_LE(pop2, pop);
+        }
+    }
+};
+
+TEST_F(row_kernels_test, all_sizes)
+{
+    for(const RowKernels* k: available_row_kernels()) {
+        for(uint32_t n = 0; n < 70; n++) {
+            for(uint32_t i = 0; i < 20; i++) {
+                check(*k, n, false);
+                check(*k, n, true);
+            }
+        }
+    }
+}
+
+TEST_F(row_kernels_test, best_is_available)
+{
+    bool found = false;
+    for(const RowKernels* k: available_row_kernels()) {
+        found |= k == &get_row_kernels(true);
+    }
+    EXPECT_TRUE(found);
+    EXPECT_EQ(&get_row_kernels(false), &row_kernels_scalar());
+}
@@ -0,0 +1,92 @@
+/******************************************
+Copyright (C) 2009-2020 Authors of CryptoMiniSat, see AUTHORS file
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+***********************************************/
+
+
+#include "gtest/gtest.h"
+
+#include <random>
+#include <vector>
+#include "src/watchsearch.h"
+
+using namespace CMSat;
+using std::vector;
+
+struct watch_search : public ::testing::Test {
+    void check(const uint32_t nVars, const uint32_t size, const double false_ratio)
+    {
+        std::mt19937 mtrand(nVars*31 + size);
+        vector<lbool> assigns(nVars);
+        for(auto& a: assigns) {
+            const uint32_t r = mtrand() % 3;
+            a = r == 0 ? l_True : (r == 1 ? l_False : l_Undef);
+        }
+        vector<lbool> lit_assigns;
+        for(const auto& a: assigns) {
+            lit_assigns.push_back(a);
+            lit_assigns.push_back(a ^ true);
+        }
+
+        vector<Lit> lits(size);
+        for(uint32_t tries = 0; tries < 200; tries++) {
+            for(auto& l: lits) {
+                // Bias towards the highest vars, where the gather is masked off
+                const uint32_t v = mtrand() % 4 == 0
+                    ? nVars - 1 - mtrand() % std::min<uint32_t>(nVars, 4)
+                    : mtrand() % nVars;
+                l = Lit(v, mtrand() & 1);
+                std::uniform_real_distribution<double> dist(0, 1);
+                if (dist(mtrand) < false_ratio
+                    && (assigns[v] ^ l.sign()) != l_False
+                    && assigns[v] != l_Undef
+                ) {
+                    l = ~l;
+                }
+            }
+            Lit* b = lits.data();
+            Lit* e = b + lits.size();
+            const uint32_t nLits = lit_assigns.size();
+            EXPECT_EQ(find_non_false_scalar(b, e, lit_assigns.data(), nLits) - b,
+                get_find_non_false(true)(b, e, lit_assigns.data(), nLits) - b);
+        }
+    }
+};
+
+TEST_F(watch_search, empty)
+{
+    vector<lbool> lit_assigns(20, l_False);
+    EXPECT_EQ(get_find_non_false(true)(nullptr, nullptr, lit_assigns.data(), 20), nullptr);
+}
+
+TEST_F(watch_search, short_clauses)
+{
+    for(uint32_t sz = 1; sz < 20; sz++) check(100, sz, 0.9);
+}
+
+TEST_F(watch_search, long_clauses)
+{
+    for(uint32_t sz = 20; sz < 300; sz += 7) check(5000, sz, 0.98);
+}
+
+TEST_F(watch_search, few_vars)
+{
+    for(uint32_t nv = 1; nv < 8; nv++) check(nv, 40, 0.95);
+}